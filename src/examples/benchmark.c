@@ -0,0 +1,315 @@
+/*
+ * benchmark.c
+ *
+ *  Render and UTF-8 decoder benchmarks (Cortex-M3 cycle counter)
+ */
+
+
+// For sprintf
+#include <stdio.h>
+
+// Include font library
+#include "../lfc_font_lib/lfc_font.h"
+
+// SSD1306 Oled display driver
+#include "../ssd1306_driver/ssd1306.h"
+
+// Include C8 fonts
+#include "../fonts/C8_fonts.h"
+
+
+
+// Number of print calls per measurement
+#define BENCHMARK_LOOPS 200
+
+// Cortex-M3 DWT cycle counter registers (not defined by this CMSIS version)
+#define DWT_CONTROL  (*(volatile uint32_t *)0xE0001000)
+#define DWT_CYCCNT   (*(volatile uint32_t *)0xE0001004)
+
+
+
+/*
+ * @brief Start Cortex-M3 cycle counter (DWT)
+ */
+static void Benchmark_Start(void){
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // Enable trace block
+	DWT_CYCCNT   = 0;
+	DWT_CONTROL |= 0x01;                            // Enable cycle counter
+}
+
+
+
+/*
+ * @brief Convert elapsed cycles to glyphs per second
+ */
+static uint32_t Benchmark_Glyphs_Per_Second(uint32_t glyphs){
+	uint32_t cycles = DWT_CYCCNT;
+	if(cycles==0){
+		return 0;
+	}
+	return (uint32_t)(((uint64_t)glyphs * SystemCoreClock) / cycles);
+}
+
+
+
+/*
+ * @brief Measure text rendering speed (Goldman_Regular_16)
+ * @return Glyphs per second
+ */
+static uint32_t Benchmark_Text(PRINT_FORM *print_form){
+
+	uint8_t str[]="LFC 0123456789";
+	uint32_t glyphs=0;
+
+	print_form->font=Goldman_Regular_16;
+
+	Benchmark_Start();
+	for(uint16_t i=0;i<BENCHMARK_LOOPS;i++){
+		LFC_Print(print_form,str,0,30);
+		glyphs+=sizeof(str)-1;
+	}
+	return Benchmark_Glyphs_Per_Second(glyphs);
+}
+
+
+
+/*
+ * @brief Measure icon rendering speed (Font_Awesome_Free_Solid_32)
+ * @return Glyphs per second
+ */
+static uint32_t Benchmark_Icons(PRINT_FORM *print_form){
+
+	uint32_t icons[4]={0xf21e,0xf015,0xf2c2,0xe55c};
+	uint32_t glyphs=0;
+	int16_t caret_x;
+
+	print_form->font=Font_Awesome_Free_Solid_32;
+
+	Benchmark_Start();
+	for(uint16_t i=0;i<BENCHMARK_LOOPS;i++){
+		caret_x=0;
+		for(uint8_t k=0;k<4;k++){
+			caret_x=LFC_Print_Utf32_Chr(print_form,icons[k],caret_x,20);
+			glyphs++;
+		}
+	}
+	return Benchmark_Glyphs_Per_Second(glyphs);
+}
+
+
+
+/*
+ * @brief Reference implementation: LFC_Utf8_To_Utf32 of the library before
+ *        the table-driven decoder (mask/pattern loop), copied unchanged and
+ *        kept only for comparison in the decoder benchmark
+ */
+static uint8_t Legacy_Utf8_To_Utf32(const uint8_t * str, uint8_t * u32_code) {
+
+	// Validate input pointers
+	if(str==NULL || u32_code==NULL){
+		return 0;
+	}
+
+	uint8_t i = 0;
+	uint8_t utf8_byte_len = 0;
+
+	// Clear UTF-32 output array (4 bytes)
+	for (uint8_t u = 0; u < 4; u++) {
+		u32_code[u] = 0;
+	}
+
+	// Check if character is ASCII
+	if ((*str) <= 127) {
+		u32_code[0] = *str;
+		return 1; // Return utf8 byte length
+	}
+
+	// --- Multi-byte UTF-8 processing ---
+
+	const uint8_t u8[5] = { 0xE0, 0xF0, 0xF8, 0xFC, 0xFE }; // Comparison masks
+	const uint8_t c8[5] = { 0xC0, 0xE0, 0xF0, 0xF8, 0xFC }; // Expected patterns
+
+	uint32_t test_code = 0;
+
+	utf8_byte_len = 0;
+
+	// Check utf8 byte count
+	for (i = 0; i < 5; i++) {
+		if ((*str & u8[i]) == c8[i]) {
+
+			// Utf-8 total byte length: i=0 2 bytes, i=4 6 bytes length
+			utf8_byte_len = i + 2;
+
+			// Masked data bits
+			test_code = (*str) & ( 0xFF >> ( i + 3 ));
+			break;
+		}
+	}
+
+	// Check if utf8 valid start byte
+	if (utf8_byte_len == 0) {
+		return 0; // UTF-8 start byte error
+	}
+
+	// First byte already processed, start from index 1 for continuation bytes
+	for (i = 1; i < utf8_byte_len; i++) {
+		str++;
+		// Check for string termination
+		if (*str == 0) {
+			return 0;
+		}
+		// Validate continuation byte format (must start with 10 binary)
+		if ((*str & 0xC0) != 0x80) {
+			return 0;
+		}
+
+		// Shift left 6-bit
+		test_code = (test_code << 6) | ((*str) & 0x3F);
+	}
+
+	// Check overlong encoding
+	switch(utf8_byte_len){
+		case 2:
+			if(test_code<0X80) return 0;
+			break;
+		case 3:
+			if(test_code<0X800) return 0;
+			break;
+		case 4:
+			if(test_code<0x10000) return 0;
+			break;
+		case 5:
+			if(test_code<0x200000) return 0;
+			break;
+		case 6:
+			if(test_code<0X4000000) return 0;
+			break;
+	}
+
+	// Surrogate pair values are invalid in UTF-8
+	if (test_code >= 0xD800 && test_code <= 0xDFFF) {
+	    return 0;
+	}
+
+	// Save little endian
+	for(int8_t j=0;j<4;j++){
+		u32_code[j] = test_code&0xFF;
+		test_code   = test_code>>8;
+	}
+
+	// Return total bytes consumed from input string
+	return utf8_byte_len;
+}
+
+
+
+// UTF-8 decoder prototype (LFC_Utf8_To_Utf32 and the legacy decoder)
+typedef uint8_t (*UTF8_DECODER)(const uint8_t * str, uint8_t * u32_code);
+
+
+
+/*
+ * @brief Measure UTF-8 decoding speed
+ * @return Code points per second
+ */
+static uint32_t Benchmark_Decoder(UTF8_DECODER decoder, const uint8_t *str){
+
+	uint8_t u32_code[4];
+	uint32_t code_points=0;
+
+	Benchmark_Start();
+	for(uint16_t i=0;i<BENCHMARK_LOOPS;i++){
+		const uint8_t *s=str;
+		while(*s){
+			uint8_t u8_len=decoder(s,u32_code);
+			if(u8_len==0){
+				break;
+			}
+			s+=u8_len;
+			code_points++;
+		}
+	}
+	return Benchmark_Glyphs_Per_Second(code_points);
+}
+
+
+
+void Decoder_Benchmark(DISPLAY_CONTEXT * main_display){
+
+	// Create print form
+	PRINT_FORM print_form;
+
+	// Set font and displayer, all extra properties are disabled and the optional fields are NULL
+	LFC_Form_Init(&print_form, Goldman_Regular_16, main_display);
+
+	// ASCII, Turkish and icon (3-byte UTF-8) strings
+	const uint8_t *strs[3]={
+		(const uint8_t *)"Temperature 23.5 C, humidity 41 %",
+		(const uint8_t *)"\xc4\x9f\xc3\xbc\xc5\x9f\xc4\xb1\xc3\xb6\xc3\xa7 \xc4\x9e\xc3\x9c\xc5\x9e\xc4\xb0\xc3\x96\xc3\x87",
+		(const uint8_t *)"\xef\x83\xb3\xef\x87\xab\xef\x88\x9e\xef\x80\x95\xef\x8b\x82\xee\x95\x9c"
+	};
+	const char *names[3]={"ASC","TR","ICO"};
+
+	uint32_t legacy_speed[3];
+	uint32_t table_speed[3];
+
+	char result[32];
+
+	for(uint8_t k=0;k<3;k++){
+		legacy_speed[k]=Benchmark_Decoder(Legacy_Utf8_To_Utf32,strs[k]);
+		table_speed[k] =Benchmark_Decoder(LFC_Utf8_To_Utf32,strs[k]);
+	}
+
+	// Show results: string, legacy and table decoder speed in thousand code points per second
+	SSD1306_Clear();
+
+	for(uint8_t k=0;k<3;k++){
+		sprintf(result,"%s %uk %uk",names[k],(unsigned int)(legacy_speed[k]/1000),(unsigned int)(table_speed[k]/1000));
+		LFC_Print(&print_form,(uint8_t *)result,0,50-k*16);
+	}
+
+	// Flush display buffer
+	SSD1306_Flush();
+
+}
+
+
+
+void Render_Benchmark(DISPLAY_CONTEXT * main_display){
+
+	// Create print form
+	PRINT_FORM print_form;
+
+	// Set font and displayer, all extra properties are disabled and the optional fields are NULL
+	LFC_Form_Init(&print_form, NULL, main_display);
+
+	uint32_t text_speed[4];
+	uint32_t icon_speed[4];
+
+	uint8_t rotation=main_display->rotation;
+
+	char result[32];
+
+	// Measure every display rotation (screen content is overwritten)
+	for(uint8_t r=0;r<4;r++){
+		main_display->rotation=r;
+		text_speed[r]=Benchmark_Text(&print_form);
+		icon_speed[r]=Benchmark_Icons(&print_form);
+	}
+
+	main_display->rotation=rotation;
+
+	// Show results: rotation, text and icon speed in thousand glyphs per second
+	SSD1306_Clear();
+
+	print_form.font=Goldman_Regular_16;
+
+	for(uint8_t r=0;r<4;r++){
+		sprintf(result,"%u: %uk %uk",(unsigned int)r*90,(unsigned int)(text_speed[r]/1000),(unsigned int)(icon_speed[r]/1000));
+		LFC_Print(&print_form,(uint8_t *)result,0,50-r*16);
+	}
+
+	// Flush display buffer
+	SSD1306_Flush();
+
+}
@@ -7,6 +7,9 @@
 
 
 
+// For sprintf
+#include <stdio.h>
+
 // Include font library
 #include "../lfc_font_lib/lfc_font.h"
 
@@ -23,20 +26,8 @@ void Simple_Print_Text(DISPLAY_CONTEXT * main_display){
 	// Create print form
 	PRINT_FORM print_form;
 
-	// Set displayer
-	print_form.display_context=main_display;
-
-	// Set font (it defined in fonts/C8_fonts.h)
-	print_form.font=Goldman_Regular_16;
-
-	// Disable all extra properties
-	print_form.config=LFC_DEFAULT_CONFIG;
-
-	// Extra space between characters
-	print_form.spacing=0;
-
-	// Padding text
-	print_form.padding=0;
+	// Set font and displayer, all extra properties are disabled and the optional fields are NULL
+	LFC_Form_Init(&print_form, Goldman_Regular_16, main_display);
 
 	// Text
 	uint8_t str[]="LFC Text";
@@ -67,11 +58,8 @@ void Text_With_Extra_Space(DISPLAY_CONTEXT * main_display){
 	// Create print form
 	PRINT_FORM print_form;
 
-	// Set displayer
-	print_form.display_context=main_display;
-
-	// Set font (it defined in fonts/C8_fonts.h)
-	print_form.font=Goldman_Regular_16;
+	// Set font and displayer, all extra properties are disabled and the optional fields are NULL
+	LFC_Form_Init(&print_form, Goldman_Regular_16, main_display);
 
 	// Enable extra space
 	print_form.config=LFC_SPACING;
@@ -79,9 +67,6 @@ void Text_With_Extra_Space(DISPLAY_CONTEXT * main_display){
 	// Extra space between characters
 	print_form.spacing=3;
 
-	// Padding text
-	print_form.padding=0;
-
 
 	// Text
 	uint8_t str[]="LFC Text";
@@ -111,18 +96,12 @@ void Text_With_Boundary_Box(DISPLAY_CONTEXT * main_display){
 	// Create print form
 	PRINT_FORM print_form;
 
-	// Set displayer
-	print_form.display_context=main_display;
-
-	// Set font (it defined in fonts/C8_fonts.h)
-	print_form.font=Goldman_Regular_16;
+	// Set font and displayer, all extra properties are disabled and the optional fields are NULL
+	LFC_Form_Init(&print_form, Goldman_Regular_16, main_display);
 
 	// Enable boundary box
 	print_form.config = LFC_BOUNDING_BOX;
 
-	// Extra space between characters
-	print_form.spacing = 0;
-
 	// Padding text
 	print_form.padding = 6;
 
@@ -147,3 +126,96 @@ void Text_With_Boundary_Box(DISPLAY_CONTEXT * main_display){
 }
 
 
+
+
+
+
+
+void Text_Box_Example(DISPLAY_CONTEXT * main_display){
+
+	// Create print form
+	PRINT_FORM print_form;
+
+	// Set font and displayer, all extra properties are disabled and the optional fields are NULL
+	LFC_Form_Init(&print_form, Goldman_Regular_16, main_display);
+
+	// Text
+	uint8_t str[]="Long messages are wrapped into the box";
+
+	// Text box, inside a frame
+	LFC_RECT frame={0,0,128,64};
+	LFC_RECT box={4,2,120,60};
+
+	// Line-break table, the text is measured only once
+	LFC_TEXT_LINE lines[8];
+	LFC_TEXT_LAYOUT layout;
+	layout.lines=lines;
+	layout.max_lines=8;
+
+	LFC_Layout_Text(&print_form,&layout,str,sizeof(str)-1,box.width);
+
+	// Clear display
+	SSD1306_Clear();
+
+	// Draw frame and centered text
+	LFC_Draw_Rect(main_display,&frame,LFC_LINE,0);
+	LFC_Draw_Text_Box(&print_form,&layout,&box,0,LFC_ALIGN_CENTER);
+
+	// Flush display buffer
+	SSD1306_Flush();
+
+}
+
+
+
+void Text_Field_Example(DISPLAY_CONTEXT * main_display){
+
+	// Create print form
+	PRINT_FORM print_form;
+
+	// Set font and displayer, all extra properties are disabled and the optional fields are NULL
+	LFC_Form_Init(&print_form, Goldman_Regular_16, main_display);
+
+	// Validate and parse the font once, the tabular cell widths are measured here
+	LFC_FONT font;
+	if(LFC_Load_Font(&font, Goldman_Regular_16)==0){
+		print_form.font_handle=&font;
+	}
+
+	// Digits have a fixed advance, a changing digit does not move the others
+	print_form.tabular=LFC_TABULAR_DIGITS;
+
+	// Track changed pixels, only they are sent to the display
+	LFC_RECT dirty={0,0,0,0};
+	main_display->dirty_rect=&dirty;
+
+	// Counter field, up to 8 glyphs
+	LFC_FIELD_CELL cells[8];
+	LFC_TEXT_FIELD counter_field;
+	LFC_Field_Init(&counter_field,cells,8,10,24);
+
+	char str[12];
+	uint32_t counter=0;
+
+	// Clear display
+	SSD1306_Clear();
+	SSD1306_Flush();
+	dirty.width=0;
+
+	while(1){
+
+		sprintf(str,"%u",(unsigned int)counter);
+
+		// Only the digits that changed are erased and drawn again
+		LFC_Field_Update(&print_form,&counter_field,(const uint8_t*)str,NULL);
+
+		// Send only the changed area, then mark the display clean
+		if(dirty.width!=0){
+			SSD1306_Flush_Rect(dirty.x, dirty.y, dirty.width, dirty.height);
+			dirty.width=0;
+		}
+
+		counter++;
+	}
+
+}
@@ -15,8 +15,17 @@ void Text_With_Extra_Space(DISPLAY_CONTEXT * main_display);
 
 void Text_With_Boundary_Box(DISPLAY_CONTEXT * main_display);
 
+void Text_Box_Example(DISPLAY_CONTEXT * main_display);
+
+void Text_Field_Example(DISPLAY_CONTEXT * main_display);
+
 
 void Font_Awesome_Example(DISPLAY_CONTEXT * main_display);
 
 
+void Render_Benchmark(DISPLAY_CONTEXT * main_display);
+
+void Decoder_Benchmark(DISPLAY_CONTEXT * main_display);
+
+
 #endif /* EXAMPLES_EXAMPLES_H_ */
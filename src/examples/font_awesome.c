@@ -17,6 +17,15 @@
 
 
 
+// Glyph cache for the big icons: 6 slots, icons up to 40x40 pixels (5 bytes per row)
+#define ICON_CACHE_SLOTS       6
+#define ICON_CACHE_BITMAP_SIZE (40*5)
+
+static uint32_t icon_cache_arena[(LFC_CACHE_ARENA_SIZE(ICON_CACHE_SLOTS, ICON_CACHE_BITMAP_SIZE)+3)/4];
+static LFC_GLYPH_CACHE icon_cache;
+
+
+
 
 
 void Print_Battery_Level(PRINT_FORM *battery_level_form,uint8_t level_percent){
@@ -32,13 +41,10 @@ void Print_Battery_Level(PRINT_FORM *battery_level_form,uint8_t level_percent){
 
 	uint32_t battery_icons[5]={0xf244,0xf243,0xf242,0xf241,0xf240};
 	uint8_t icon_index;
-	int16_t pos_x;
-	int16_t pos_y;
+	uint8_t config;
 
 	uint32_t current_icon;
 
-	LFC_RECT battery_rect;
-
 	if(level_percent>100){
 		level_percent=100;
 	}
@@ -47,15 +53,15 @@ void Print_Battery_Level(PRINT_FORM *battery_level_form,uint8_t level_percent){
 
 	current_icon = battery_icons[icon_index];
 
-	LFC_Utf32_Char_Rect(battery_level_form,current_icon,0,0,&battery_rect);
-
 	DISPLAY_CONTEXT * display = battery_level_form->display_context;
 
-	// Top right position
-	pos_x=display->width  - battery_rect.width;
-	pos_y=display->height - battery_rect.height;
+	// Top right position, the icon is measured and drawn in one call
+	config=battery_level_form->config;
+	battery_level_form->config|=LFC_ANCHOR_RIGHT|LFC_ANCHOR_TOP;
+
+	LFC_Print_Utf32_Chr(battery_level_form,current_icon, display->width, display->height);
 
-	LFC_Print_Utf32_Chr(battery_level_form,current_icon, pos_x, pos_y);
+	battery_level_form->config=config;
 
 
 	return;
@@ -68,21 +74,12 @@ void Font_Awesome_Example(DISPLAY_CONTEXT * main_display){
 	// Create print form
 	PRINT_FORM print_form;
 
-	// Set displayer
-	print_form.display_context=main_display;
-
-	// Set font (it defined in fonts/C8_fonts.h)
-	print_form.font=Font_Awesome_Free_Solid_16;
+	// Set font and displayer, all extra properties are disabled and the optional fields are NULL
+	LFC_Form_Init(&print_form, Font_Awesome_Free_Solid_16, main_display);
 
 	// Disable all extra properties
 	print_form.config=LFC_SPACING;
 
-	// Extra space between characters
-	print_form.spacing=0;
-
-	// Padding text
-	print_form.padding=0;
-
 	uint32_t counter=0;
 
 	/*
@@ -115,9 +112,23 @@ void Font_Awesome_Example(DISPLAY_CONTEXT * main_display){
 	PRINT_FORM big_icons_form;
 	LFC_Copy_Print_Form(&big_icons_form,&print_form);
 	big_icons_form.font=Font_Awesome_Free_Solid_32;
+
+	// Validate and parse the icon font once, not on every print
+	LFC_FONT big_icons_font;
+	if(LFC_Load_Font(&big_icons_font, Font_Awesome_Free_Solid_32)==0){
+		big_icons_form.font_handle=&big_icons_font;
+	}
 	big_icons_form.spacing=10;
 	big_icons_form.padding=6;
 
+	// Visible big icons are redrawn every frame, keep them in the glyph cache
+	LFC_Cache_Init(&icon_cache, icon_cache_arena, sizeof(icon_cache_arena), ICON_CACHE_BITMAP_SIZE);
+	big_icons_form.glyph_cache=&icon_cache;
+
+	// Shape the big icons once, every frame only draws the glyph run
+	LFC_GLYPH big_icons_run[13];
+	uint16_t big_icons_count=LFC_Shape_Utf32(&big_icons_form,big_icons,13,big_icons_run,13);
+
 
 
 	uint32_t bell_icon=0xf0f3;
@@ -145,9 +156,9 @@ void Font_Awesome_Example(DISPLAY_CONTEXT * main_display){
 
 		// Print big icons
 		caret_x=pos_x; // start x position
-		for(uint8_t i=0;i<13;i++){
+		for(uint16_t i=0;i<big_icons_count;i++){
 			// Print icon and return next caret position for next icon
-			caret_x=LFC_Print_Utf32_Chr(&big_icons_form,big_icons[i], caret_x, pos_y);
+			caret_x=LFC_Draw_Run(&big_icons_form,&big_icons_run[i],1, caret_x, pos_y);
 		}
 
 		pos_x--;
@@ -50,6 +50,19 @@ static const uint8_t Font_Awesome_Free_Solid_16[]={ 0xC8,0x05,0x10,0x08,0x00,0xF
 static const uint8_t Font_Awesome_Free_Solid_32[]={ 0xC8,0x05,0x20,0x0D,0x00,0x5C,0xE5,0x00,0x00,0x53,0x00,0x98,0xE5,0x00,0x00,0xFA,0x00,0x15,0xF0,0x00,0x00,0xAA,0x01,0x84,0xF0,0x00,0x00,0x2F,0x02,0x30,0xF1,0x00,0x00,0xB4,0x02,0x1E,0xF2,0x00,0x00,0x19,0x03,0xC2,0xF2,0x00,0x00,0x8E,0x03,0xCC,0xF2,0x00,0x00,0x11,0x04,0xED,0xF2,0x00,0x00,0x86,0x04,0x79,0xF4,0x00,0x00,0xFF,0x04,0x2F,0xF5,0x00,0x00,0x64,0x05,0xB9,0xF7,0x00,0x00,0xE5,0x05,0x6D,0xF8,0x00,0x00,0x72,0x06,0x24,0x24,0x1E,0x04,0x28,0x01,0x80,0x18,0x00,0x00,0x3C,0x03,0xC0,0x00,0x03,0xC0,0x3C,0x00,0x00,0x3C,0x03,0xC0,0x00,0x03,0xC0,0x3C,0x00,0x00,0x3C,0x03,0xC0,0x00,0x03,0xC0,0x3C,0x00,0x00,0x3C,0x03,0xC0,0x00,0x7F,0xFF,0xFF,0xE0,0x0F,0xFF,0xFF,0xFF,0x00,0xFF,0xFF,0xFF,0xF0,0x07,0xFF,0xFF,0xFE,0x00,0x3F,0xFF,0xFF,0xC0,0x03,0xFF,0xFF,0xFC,0x00,0x3F,0xFF,0xFF,0xC0,0x03,0xFF,0xFF,0xF0,0x00,0x3F,0xFF,0xF8,0x00,0x03,0xFF,0xFF,0x00,0x00,0x3F,0xFF,0xC0,0xFC,0x03,0xFF,0xFC,0x3F,0xF0,0x1F,0xFF,0x87,0xFF,0x81,0xFF,0xF0,0xFF,0xFC,0x0F,0xFF,0x1F,0xFF,0xE0,0x7F,0xF1,0xFF,0x9E,0x07,0xFE,0x3F,0xF1,0xF0,0x1F,0xE3,0xFF,0x3F,0x00,0xFE,0x3E,0xE7,0xF0,0x01,0xE3,0xE4,0x7F,0x00,0x0E,0x3F,0x0F,0xF0,0x00,0xE3,0xF9,0xFF,0x00,0x0F,0x1F,0xFF,0xE0,0x00,0xF1,0xFF,0xFE,0x00,0x0F,0x0F,0xFF,0xC0,0x00,0x60,0x7F,0xF8,0x00,0x00,0x03,0xFF,0x00,0x00,0x00,0x0F,0xC0,0x26,0x24,0x1C,0x02,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x8E,0x00,0x00,0x07,0x1E,0x78,0x00,0x00,0x3E,0xFB,0xE0,0x00,0x00,0xFF,0xDF,0x00,0x00,0x03,0xFE,0xF8,0x00,0x00,0x0F,0xF7,0xC0,0x00,0x00,0x3F,0xFE,0xE0,0x00,0x18,0xFF,0xF7,0x80,0x00,0xF3,0xFF,0xBE,0x00,0x03,0xE7,0xFF,0xF0,0x00,0x1F,0xCF,0xFF,0x80,0x00,0x7F,0x9F,0xFC,0x00,0x01,0xFE,0x3F,0xF8,0x00,0x07,0xF8,0x7F,0xF0,0x03,0x8F,0xE0,0xF0,0x20,0x1F,0x3F,0x80,0x00,0x00,0x7E,0x7F,0xF0,0x00,0x01,0xFC,0xFF,0x83,0xF0,0x07,0xF1,0xFC,0x3F,0xF0,0x1F,0xE3,0xE1,0xFF,0xE0,0x7F,0x87,0x0F,0xCF,0xC1,0xFE,0x0C,0x7F,0x3F,0x83,0xFF,0x11,0xFC,0xFE,0x07,0xFF,0x0F,0xF3,0xFC,0x0F,0xFE,0x3F,0xCF,0xF0,0x7F,0xF8,0xFF,0x3F,0xC3,0xFF,0xE3,0xFC,0xFF,0x1F,0x7F,0x8F,0xFF,0xFC,0xF8,0xFE,0x3F,0xFF,0xF7,0xC1,0xFC,0x7F,0x3F,0x9E,0x00,0x01,0xFC,0xFE,0x70,0x00,0x03,0xFF,0xF0,0x00,0x00,0x07,0xFF,0x80,0x00,0x00,0x0F,0xFC,0x00,0x00,0x00,0x0F,0xC0,0x20,0x20,0x1C,0x00,0x20,0x00,0x01,0x80,0x00,0x00,0x03,0xC0,0x00,0x00,0x07,0xE0,0x00,0x00,0x1F,0xF8,0x00,0x00,0x3F,0xFC,0x00,0x00,0x7F,0xFE,0x00,0x00,0xFF,0xFF,0x00,0x01,0xFF,0xFF,0x80,0x03,0xFF,0xFF,0xC0,0x07,0xFF,0xFF,0xE0,0x0F,0xFF,0xFF,0xF0,0x1F,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFC,0x7F,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFE,0x1F,0xFF,0xFF,0xF8,0x1F,0xFF,0xFF,0xF8,0x1F,0xFF,0xFF,0xF8,0x1F,0xF8,0x1F,0xF8,0x1F,0xF0,0x0F,0xF8,0x1F,0xF0,0x0F,0xF8,0x1F,0xF0,0x0F,0xF8,0x1F,0xF0,0x0F,0xF8,0x1F,0xF0,0x0F,0xF8,0x1F,0xF0,0x0F,0xF8,0x1F,0xF0,0x0F,0xF8,0x1F,0xF0,0x0F,0xF8,0x1F,0xFF,0xFF,0xF8,0x0F,0xFF,0xFF,0xF0,0x07,0xFF,0xFF,0xE0,0x20,0x20,0x1C,0x00,0x20,0x00,0x00,0x3F,0x00,0x00,0x01,0xFF,0xE0,0x00,0x03,0xFF,0xF0,0x00,0x07,0xFF,0xF8,0x00,0x0F,0xFF,0xFC,0x00,0x1F,0xFF,0xFC,0x00,0x1F,0xFC,0x7E,0x00,0x1F,0xF8,0x3E,0x00,0x3F,0xF8,0x3F,0x00,0x3F,0xF8,0x3F,0x00,0x3F,0xFC,0x7F,0x00,0x3F,0xFF,0xFF,0x00,0x3F,0xFF,0xFF,0x00,0x3F,0xFF,0xFF,0x00,0x3F,0xFF,0xFE,0x00,0x7F,0xFF,0xFE,0x00,0xFF,0xFF,0xFE,0x01,0xFF,0xFF,0xFC,0x03,0xFF,0xFF,0xF8,0x07,0xFF,0xFF,0xF0,0x0F,0xFF,0xFF,0xE0,0x1F,0xFF,0xFF,0x00,0x3F,0xFF,0x80,0x00,0x7F,0xFF,0x00,0x00,0xFF,0xF0,0x00,0x00,0xFF,0xF0,0x00,0x00,0xFF,0xF0,0x00,0x00,0xFF,0xF0,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x18,0x20,0x1C,0x00,0x18,0x00,0x3C,0x00,0x00,0xFF,0x00,0x01,0xFF,0x80,0x01,0xFF,0x80,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0xE3,0xFF,0xC7,0xE3,0xFF,0xC7,0xE3,0xFF,0xC7,0xE3,0xFF,0xC7,0xE3,0xFF,0xC7,0xE3,0xFF,0xC7,0xE1,0xFF,0x87,0xF1,0xFF,0x8E,0x70,0xFF,0x0E,0x78,0x3C,0x1E,0x3C,0x00,0x3C,0x1E,0x00,0x78,0x1F,0x81,0xF0,0x07,0xFF,0xE0,0x03,0xFF,0xC0,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x20,0x1C,0x1A,0x00,0x20,0x07,0xE0,0x07,0xC0,0x0F,0xF8,0x1F,0xF0,0x3F,0xFC,0x3F,0xFC,0x3F,0xFE,0x7F,0xFC,0x7F,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0xFF,0xFF,0xFF,0xC7,0xFF,0xFF,0xFF,0x83,0xE7,0xFF,0xFF,0x83,0xC3,0xFF,0xFF,0x83,0xC3,0xFF,0x7F,0x11,0x81,0xFE,0x00,0x11,0x80,0x00,0x00,0x18,0x10,0x00,0x00,0x78,0x18,0x00,0x1F,0xF8,0x1F,0xF8,0x0F,0xFC,0x3F,0xF0,0x0F,0xFC,0x3F,0xF0,0x07,0xFE,0x7F,0xE0,0x03,0xFF,0xFF,0xC0,0x01,0xFF,0xFF,0x80,0x00,0xFF,0xFF,0x00,0x00,0x7F,0xFE,0x00,0x00,0x3F,0xFC,0x00,0x00,0x1F,0xF8,0x00,0x00,0x0F,0xF0,0x00,0x00,0x03,0xC0,0x00,0x24,0x1C,0x1A,0x00,0x24,0x3F,0xFF,0xFF,0xFF,0xC7,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x7F,0x80,0x1F,0xFF,0x03,0xF8,0x01,0xFF,0xF0,0x3F,0x80,0x1F,0xFF,0x03,0xFF,0xFF,0xFF,0xF0,0x3F,0xFF,0xFF,0xFF,0x87,0xFF,0xFF,0xFF,0xFF,0xFF,0x80,0x1F,0xFF,0xFF,0xF8,0x01,0xFF,0xFF,0xFF,0x80,0x1F,0xFE,0x01,0xFF,0xFF,0xFF,0x80,0x07,0xFF,0xFF,0xF8,0x00,0x7F,0xFF,0xFF,0x80,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFF,0xE3,0xFF,0xFF,0xFF,0xFC,0x20,0x1C,0x1A,0x00,0x20,0x0F,0x80,0x00,0x00,0x3F,0xC0,0x00,0x00,0x7F,0xE7,0xC0,0x00,0x7F,0xFF,0xFC,0x00,0xF8,0xFF,0xFC,0x00,0xF0,0x7F,0xFC,0x00,0xF0,0xFF,0xF8,0x00,0xF0,0xFF,0xF0,0x00,0xF0,0xFF,0xE1,0x80,0xF0,0xFF,0xC3,0xC0,0xF0,0xFF,0x83,0xC6,0xF0,0xFF,0x01,0x8F,0xF0,0x7E,0x18,0x0F,0xF0,0x7C,0x3C,0x06,0xF0,0x78,0x3C,0x60,0xF0,0x70,0x18,0xF0,0xF0,0x01,0x80,0xF0,0xF0,0x03,0xC0,0x60,0xF0,0x03,0xC6,0x00,0xF0,0x01,0x8F,0x00,0xF0,0x00,0x0F,0x00,0xF0,0x00,0x06,0x00,0xF0,0x00,0x60,0x00,0xF0,0x00,0xF0,0x00,0xF0,0x00,0xF0,0x00,0xF0,0x00,0x60,0x00,0xF0,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x1C,0x21,0x1D,0x00,0x1C,0x00,0x7F,0xE0,0x00,0x07,0xFE,0x00,0x00,0xFF,0xF0,0x07,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0xFF,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xC3,0xFF,0xFF,0xFC,0x3F,0xFF,0xFF,0xC3,0xFF,0xFF,0xFC,0x3C,0x79,0xE3,0xC3,0xC7,0x9E,0x3C,0x3C,0x79,0xE3,0xC3,0xC7,0x9E,0x3C,0x3C,0x79,0xE3,0xC3,0xC7,0x9E,0x3C,0x3C,0x79,0xE3,0xC3,0xC7,0x9E,0x3C,0x3C,0x79,0xE3,0xC3,0xC7,0x9E,0x3C,0x3C,0x79,0xE3,0xC3,0xC7,0x9E,0x3C,0x3C,0x79,0xE3,0xC3,0xC7,0x9E,0x3C,0x3C,0x79,0xE3,0xC3,0xFF,0xFF,0xFC,0x3F,0xFF,0xFF,0xC1,0xFF,0xFF,0xF8,0x0F,0xFF,0xFF,0x00,0x20,0x18,0x18,0x00,0x20,0x38,0xFF,0xFF,0x1C,0x78,0xFF,0xFF,0x1E,0xF8,0xFF,0xFF,0x1F,0xF8,0xFF,0xFF,0x1F,0xF8,0xFF,0xFF,0x1F,0xF8,0xFF,0xFF,0x1F,0xF8,0xFF,0xFF,0x1F,0xF8,0xFC,0x3F,0x1F,0xF8,0xFC,0x3F,0x1F,0xF8,0xFC,0x3F,0x1F,0xF8,0xE0,0x07,0x1F,0xF8,0xE0,0x07,0x1F,0xF8,0xE0,0x07,0x1F,0xF8,0xE0,0x07,0x1F,0xF8,0xFC,0x3F,0x1F,0xF8,0xFC,0x3F,0x1F,0xF8,0xFC,0x3F,0x1F,0xF8,0xFF,0xFF,0x1F,0xF8,0xFF,0xFF,0x1F,0xF8,0xFF,0xFF,0x1F,0xF8,0xFF,0xFF,0x1F,0xF8,0xFF,0xFF,0x1F,0x78,0xFF,0xFF,0x1E,0x38,0xFF,0xFF,0x1C,0x1F,0x20,0x1C,0x01,0x20,0x1F,0xFF,0x80,0x00,0x7F,0xFF,0x80,0x01,0xFF,0xFF,0x87,0x03,0xFF,0xFF,0x0F,0x07,0x80,0x1E,0x1E,0x0F,0x00,0x3C,0x1E,0x1E,0x00,0x78,0x1E,0x3C,0x00,0xF0,0x3E,0x78,0x01,0xE0,0x7E,0xF0,0x03,0xC0,0xFD,0xE0,0x07,0x81,0xFB,0xC0,0x0F,0x03,0xF7,0xFF,0xFE,0x03,0xEF,0xFF,0xFC,0x03,0xDF,0xFF,0xF8,0x03,0xBF,0xFF,0xF0,0x07,0x7F,0xFF,0xFC,0x0E,0xFF,0xFF,0xFC,0x1D,0xFF,0xFF,0xFC,0x3B,0xFF,0xFF,0x3C,0x77,0xFF,0xFE,0x38,0xEF,0xFF,0xFC,0x71,0xDF,0xFF,0xF8,0xE3,0xBF,0xFF,0xF1,0xC7,0x7F,0xFF,0xE3,0x8E,0xFF,0xFF,0xC7,0xFD,0xFF,0xFF,0x87,0xF3,0xFF,0xFF,0x07,0xC7,0xFF,0xFE,0x00,0x1F,0xFF,0xFE,0x00,0x3F,0xFF,0xFC,0x00,0x7F,0xFF,0xF8,0x00,0x22,0x20,0x1B,0x01,0x24,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x38,0x00,0x3C,0x00,0x0F,0x80,0x1F,0x80,0x07,0xF0,0x0F,0xE0,0x01,0xFC,0x07,0xFC,0x00,0xFF,0x83,0xFF,0x80,0x3F,0xF0,0xFF,0xE0,0x1F,0xFC,0x7F,0xFC,0x0F,0xFF,0x9F,0xFF,0x03,0xFF,0xE7,0xFF,0x80,0x7F,0xFB,0xFF,0xC0,0x0F,0xFF,0xFF,0xF1,0xE3,0xFF,0xFF,0xF8,0xFC,0x7F,0xF7,0xFE,0x3F,0x1F,0xF8,0x00,0x0F,0xC0,0x00,0x00,0x03,0xF0,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x18,0x00,0x00,0x01,0xFE,0x00,0x00,0x00,0xFF,0xC0,0x00,0x00,0x3F,0xF0,0x00,0x00,0x1F,0xFE,0x00,0x00,0x07,0xFF,0x80,0x00,0x03,0xFF,0xF0,0x00,0x01,0xFF,0xFE,0x00,0x00,0x7F,0xFF,0x80,0x00,0x1F,0xFF,0xE0,0x00,0x03,0xFF,0xF0,0x00,0x00,0x1F,0xE0,0x00,0x20,0x20,0x1C,0x00,0x20,0x3C,0x3C,0x00,0x07,0x7E,0x7E,0x00,0x7F,0xFF,0xFF,0x03,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0xFF,0xFF,0xFF,0x1F,0xE7,0xFF,0xFF,0x1F,0x07,0x7F,0xFE,0x1C,0x07,0x3F,0xFC,0x1C,0x3F,0x1F,0xF8,0x1C,0x7F,0x0F,0xF0,0x1C,0xFF,0x07,0xE0,0xFC,0xFF,0x03,0xC1,0xFC,0xFE,0x00,0x03,0xFC,0x3C,0x00,0x03,0xFC,0x00,0x00,0x03,0xF8,0x00,0x00,0x00,0xF0,0x0C,0x03,0xF0,0x00,0x1C,0x07,0xF8,0x00,0x38,0x7F,0xFF,0x80,0x78,0xFF,0xFF,0xC0,0xF8,0xFF,0xFF,0xC3,0xF0,0xFF,0xFF,0xC7,0xF0,0xFE,0x1F,0xCF,0xFF,0xFC,0x0F,0xCF,0xFF,0xFC,0x0F,0xC0,0xFE,0xFC,0x0F,0xC0,0xFC,0xFE,0x1F,0xC1,0xF8,0xFF,0xFF,0xC1,0xE0,0xFF,0xFF,0xC1,0xC0,0xFF,0xFF,0xC3,0x80,0x7F,0xFF,0x83,0x00 };
 
 
+/***************************************************************************************************
+** Source Font      : Font Awesome 7 Free-Solid-900.otf
+** Font Size        : 16
+** Total Bytes      : 355
+** Character Count  : 8
+** Font Format Type : D8 (C8 with 4-byte offsets)
+** Create Time      : Sat Oct 17 00:31:40 2026
+** Note             : Font_Awesome_Free_Solid_16 with the wide character map, for testing the
+**                    wide font path on a small font. Not accepted with LFC_OFFSET_16.
+****************************************************************************************************/
+static const uint8_t Font_Awesome_Free_Solid_16_D8[]={ 0xD8,0x05,0x10,0x08,0x00,0xF3,0xF0,0x00,0x00,0x45,0x00,0x00,0x00,0xEB,0xF1,0x00,0x00,0x66,0x00,0x00,0x00,0xF6,0xF1,0x00,0x00,0x8B,0x00,0x00,0x00,0x40,0xF2,0x00,0x00,0xB9,0x00,0x00,0x00,0x41,0xF2,0x00,0x00,0xDB,0x00,0x00,0x00,0x42,0xF2,0x00,0x00,0xFD,0x00,0x00,0x00,0x43,0xF2,0x00,0x00,0x1F,0x01,0x00,0x00,0x44,0xF2,0x00,0x00,0x41,0x01,0x00,0x00,0x0E,0x10,0x0E,0x00,0x0E,0x03,0x00,0x1E,0x01,0xFE,0x07,0xF8,0x3F,0xF0,0xFF,0xC3,0xFF,0x0F,0xFC,0x3F,0xF1,0xFF,0xE7,0xFF,0xBF,0xFF,0xFF,0xFC,0x00,0x00,0x78,0x00,0xC0,0x12,0x0E,0x0D,0x00,0x12,0x07,0xF8,0x07,0xFF,0x83,0xC0,0xF3,0xC0,0x0F,0xC0,0x00,0xC0,0x00,0x00,0x7F,0x80,0x3F,0xF0,0x0C,0x0C,0x02,0x01,0x00,0x00,0x00,0x03,0x00,0x01,0xE0,0x00,0x30,0x00,0x12,0x12,0x0F,0x00,0x12,0xC0,0x00,0x38,0x30,0x07,0x1E,0x00,0xFF,0xE0,0x1F,0xF8,0x03,0xFF,0x00,0x7F,0xC0,0x0F,0xF0,0x09,0xFC,0x03,0x3F,0x01,0xE7,0xE0,0x7C,0xF8,0x3F,0x9F,0x0F,0xF3,0xC0,0x00,0x70,0x07,0x8E,0x00,0xC1,0xC0,0x00,0x30,0x13,0x0C,0x0C,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x67,0xFE,0x6D,0xFF,0xEF,0xBF,0xFD,0xF7,0xFF,0xBE,0xFF,0xF7,0xCF,0xFC,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0,0x13,0x0C,0x0C,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x67,0xF0,0x6D,0xFF,0x0F,0xBF,0xE1,0xF7,0xFC,0x3E,0xFF,0x87,0xCF,0xE0,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0,0x13,0x0C,0x0C,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x67,0xC0,0x6D,0xFC,0x0F,0xBF,0x81,0xF7,0xF0,0x3E,0xFE,0x07,0xCF,0x80,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0,0x13,0x0C,0x0C,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x66,0x00,0x6D,0xE0,0x0F,0xBC,0x01,0xF7,0x80,0x3E,0xF0,0x07,0xCC,0x00,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0,0x13,0x0C,0x0B,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x60,0x00,0x6C,0x00,0x0F,0x80,0x01,0xF0,0x00,0x3E,0x00,0x07,0xC0,0x00,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0 };
+
+
 
 
 
@@ -0,0 +1,48 @@
+#ifndef C9_FONTS_H
+#define C9_FONTS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+#include <stdint.h>
+
+
+
+/***************************************************************************************************
+** Source Font      : Goldman-Regular.ttf
+** Font Size        : 16
+** Total Bytes      : 1551
+** Character Count  : 95
+** Font Format Type : C9
+** Create Time      : Fri Oct 16 10:12:31 2026
+** Note             : Goldman_Regular_16 (C8) with the range character map.
+****************************************************************************************************/
+static const uint8_t Goldman_Regular_16_C9[]={ 0xC9,0x07,0x13,0x5F,0x00,0x01,0x00,0x20,0x00,0x00,0x00,0x5F,0x00,0x00,0x00,0xCD,0x00,0xD3,0x00,0xDC,0x00,0xE3,0x00,0xF6,0x00,0x08,0x01,0x1B,0x01,0x2E,0x01,0x34,0x01,0x3F,0x01,0x49,0x01,0x53,0x01,0x60,0x01,0x66,0x01,0x6C,0x01,0x72,0x01,0x81,0x01,0x92,0x01,0x9C,0x01,0xAC,0x01,0xBC,0x01,0xCD,0x01,0xDD,0x01,0xEE,0x01,0xFF,0x01,0x0F,0x02,0x1F,0x02,0x27,0x02,0x30,0x02,0x3C,0x02,0x44,0x02,0x50,0x02,0x5E,0x02,0x74,0x02,0x88,0x02,0x9A,0x02,0xAC,0x02,0xBE,0x02,0xD0,0x02,0xE1,0x02,0xF3,0x02,0x05,0x03,0x0D,0x03,0x1D,0x03,0x30,0x03,0x41,0x03,0x54,0x03,0x66,0x03,0x78,0x03,0x89,0x03,0x9F,0x03,0xB2,0x03,0xC3,0x03,0xD5,0x03,0xE6,0x03,0xF9,0x03,0x13,0x04,0x26,0x04,0x39,0x04,0x4A,0x04,0x55,0x04,0x64,0x04,0x6F,0x04,0x77,0x04,0x7D,0x04,0x84,0x04,0x91,0x04,0xA2,0x04,0xAE,0x04,0xBD,0x04,0xC9,0x04,0xD8,0x04,0xE7,0x04,0xF8,0x04,0x00,0x05,0x0C,0x05,0x1D,0x05,0x25,0x05,0x36,0x05,0x43,0x05,0x4F,0x05,0x60,0x05,0x6F,0x05,0x7B,0x05,0x87,0x05,0x94,0x05,0xA0,0x05,0xAD,0x05,0xBF,0x05,0xCC,0x05,0xDE,0x05,0xEA,0x05,0xF5,0x05,0xFD,0x05,0x08,0x06,0x01,0x01,0x01,0x00,0x04,0x00,0x03,0x09,0x09,0x01,0x05,0xFF,0xB6,0x83,0x60,0x04,0x04,0x0C,0x01,0x06,0xFF,0xB9,0x0C,0x09,0x09,0x01,0x0E,0x0C,0x60,0xCC,0x7F,0xF1,0x8C,0x19,0x83,0x18,0xFF,0xE3,0x30,0x63,0x00,0x09,0x0B,0x0A,0x01,0x0B,0x08,0x3F,0xF8,0x18,0x0C,0x03,0xF8,0x06,0x03,0x01,0xFF,0x82,0x00,0x0C,0x09,0x09,0x01,0x0E,0xF0,0xC9,0x98,0x9B,0x0F,0xB0,0x06,0x00,0x4F,0x0C,0x91,0x89,0x18,0xF0,0x0C,0x09,0x09,0x01,0x0D,0x3E,0x03,0x30,0x30,0x07,0x86,0xEC,0x6C,0x76,0xC3,0xCE,0x3C,0x7E,0xF0,0x02,0x04,0x0C,0x01,0x03,0xFA,0x04,0x0C,0x0B,0x00,0x05,0x36,0x6C,0xCC,0xCC,0xC6,0x63,0x03,0x0C,0x0B,0x01,0x05,0xD9,0xB6,0xDB,0x6F,0x40,0x06,0x06,0x0A,0x01,0x09,0x31,0x5F,0xCC,0x6C,0xA0,0x08,0x08,0x09,0x01,0x0A,0x18,0x18,0x18,0x18,0xFF,0x18,0x18,0x18,0x02,0x04,0x02,0x01,0x05,0xF6,0x05,0x01,0x05,0x01,0x08,0xF8,0x03,0x02,0x02,0x01,0x05,0xF8,0x07,0x0B,0x0A,0x00,0x07,0x06,0x18,0x30,0xC1,0x83,0x0C,0x18,0x60,0xC3,0x80,0x0A,0x09,0x09,0x01,0x0C,0x7F,0xB8,0x7C,0x0F,0x03,0xC0,0xF0,0x3C,0x0F,0x87,0x7F,0x80,0x04,0x09,0x09,0x00,0x06,0xF3,0x33,0x33,0x33,0x30,0x09,0x09,0x09,0x01,0x0A,0xFE,0x41,0x80,0xC0,0x60,0x70,0xE0,0xE1,0xC0,0xFF,0x80,0x09,0x09,0x09,0x01,0x0B,0xFF,0x41,0xC0,0x60,0x77,0xF0,0x0C,0x06,0x03,0xFF,0x00,0x0A,0x09,0x09,0x01,0x0C,0x07,0x03,0xC1,0xB0,0xCC,0x63,0x30,0xCF,0xFC,0x0C,0x03,0x00,0x09,0x09,0x09,0x01,0x0B,0xFF,0xE0,0x30,0x1F,0xE8,0x18,0x0C,0x06,0x03,0xFF,0x00,0x0A,0x09,0x09,0x01,0x0C,0x7F,0xB8,0x0C,0x03,0xFE,0xC1,0xF0,0x3C,0x0F,0x87,0x7F,0x80,0x0A,0x09,0x09,0x00,0x0A,0xFF,0xC0,0x70,0x18,0x0C,0x07,0x03,0x80,0xC0,0x70,0x38,0x00,0x09,0x09,0x09,0x01,0x0B,0x7F,0x71,0xF0,0x7C,0x37,0xF6,0x0F,0x07,0x83,0x7F,0x80,0x09,0x09,0x09,0x01,0x0C,0x7F,0x60,0xF0,0x78,0x3F,0xF8,0x0C,0x07,0x03,0xFF,0x00,0x03,0x07,0x07,0x01,0x05,0xF8,0x01,0xF0,0x03,0x09,0x07,0x01,0x05,0xF8,0x01,0xB2,0x80,0x08,0x07,0x09,0x01,0x0A,0x03,0x1F,0xF8,0xE0,0x7C,0x1F,0x03,0x08,0x03,0x06,0x01,0x09,0xFF,0x00,0xFF,0x08,0x07,0x09,0x01,0x0A,0xC0,0xF8,0x1F,0x03,0x1F,0xF8,0xC0,0x08,0x09,0x09,0x01,0x0A,0xFE,0x87,0x03,0x03,0x3E,0x30,0x00,0x30,0x30,0x0D,0x0A,0x09,0x01,0x0F,0x7F,0xF2,0x00,0xF7,0xF7,0xB1,0xBD,0x8D,0xEC,0xEF,0x7D,0xD8,0x00,0xC0,0x23,0xFE,0x00,0x0D,0x09,0x09,0x00,0x0D,0x0F,0x00,0x7C,0x07,0x60,0x33,0x83,0x8C,0x18,0x71,0xFF,0x8C,0x0E,0xE0,0x38,0x0B,0x09,0x09,0x01,0x0D,0xFF,0x98,0x1B,0x03,0x60,0x6F,0xFD,0x81,0xF0,0x1E,0x07,0xFF,0xC0,0x0B,0x09,0x09,0x01,0x0C,0x7F,0xDC,0x03,0x00,0x60,0x0C,0x01,0x80,0x30,0x07,0x00,0x7F,0xE0,0x0B,0x09,0x09,0x01,0x0D,0xFF,0xDC,0x1F,0x81,0xF0,0x3E,0x07,0xC0,0xF8,0x1F,0x07,0xFF,0xC0,0x0B,0x09,0x09,0x01,0x0C,0xFF,0xD8,0x03,0x00,0x60,0x0F,0xF1,0x80,0x30,0x06,0x00,0xFF,0xE0,0x0A,0x09,0x09,0x01,0x0C,0xFF,0xF8,0x0E,0x03,0x80,0xFF,0xB8,0x0E,0x03,0x80,0xE0,0x00,0x0B,0x09,0x09,0x01,0x0D,0x7F,0xDC,0x03,0x00,0x60,0x0C,0x7F,0x81,0xF0,0x3F,0x07,0x7F,0xE0,0x0B,0x09,0x09,0x01,0x0D,0xC0,0x78,0x0F,0x01,0xE0,0x3F,0xFF,0x80,0xF0,0x1E,0x03,0xC0,0x60,0x02,0x09,0x09,0x01,0x05,0xFF,0xFF,0xC0,0x09,0x09,0x09,0x00,0x0B,0x01,0x80,0xC0,0x60,0x30,0x18,0x0C,0x06,0xC7,0xFF,0x80,0x0C,0x09,0x09,0x01,0x0D,0xE1,0xCE,0x38,0xE7,0x0E,0xE0,0xFC,0x0E,0x70,0xE3,0x8E,0x1F,0xE0,0x60,0x0A,0x09,0x09,0x01,0x0B,0xE0,0x38,0x0E,0x03,0x80,0xE0,0x38,0x0E,0x03,0xFE,0xFF,0xC0,0x0C,0x09,0x09,0x01,0x0F,0xE0,0x3F,0x07,0xF0,0x7F,0x8F,0xF9,0xBE,0xDB,0xE7,0x3E,0x73,0xE0,0x30,0x0B,0x09,0x09,0x01,0x0D,0xE0,0x7E,0x0F,0xE1,0xFE,0x3E,0xE7,0xCE,0xF8,0xFF,0x0F,0xE0,0xE0,0x0B,0x09,0x09,0x01,0x0D,0x7F,0xDC,0x1B,0x01,0xE0,0x3C,0x07,0x80,0xF0,0x1F,0x06,0x7F,0xC0,0x0A,0x09,0x09,0x01,0x0C,0xFF,0xB8,0x3E,0x0F,0x83,0xE0,0xFF,0xFE,0x03,0x80,0xE0,0x00,0x0D,0x0A,0x09,0x01,0x0D,0x7F,0xC7,0x06,0x30,0x19,0x80,0xCC,0x06,0x60,0x73,0x03,0x1C,0x38,0x7F,0x00,0x0F,0xC0,0x0C,0x09,0x09,0x01,0x0D,0xFF,0x8E,0x0C,0xE0,0xCE,0x0C,0xFF,0xCE,0x70,0xE1,0x8E,0x0E,0xE0,0x70,0x0A,0x09,0x09,0x01,0x0C,0x7F,0xF8,0x0C,0x03,0x00,0x7F,0x80,0x30,0x0C,0x03,0xFF,0x80,0x0B,0x09,0x09,0x00,0x0B,0xFF,0xE1,0xC0,0x38,0x07,0x00,0xE0,0x1C,0x03,0x80,0x70,0x0E,0x00,0x0A,0x09,0x09,0x01,0x0C,0xC0,0xF0,0x3C,0x0F,0x03,0xC0,0xF0,0x3C,0x0F,0x87,0x7F,0x80,0x0C,0x09,0x09,0x00,0x0C,0xE0,0x76,0x06,0x70,0xE3,0x0C,0x31,0xC1,0x98,0x1B,0x00,0xF0,0x0E,0x00,0x12,0x09,0x09,0x00,0x12,0xE1,0xC1,0xD8,0x78,0x66,0x1E,0x19,0xCD,0x8C,0x33,0x33,0x0C,0xCD,0xC1,0xE1,0x60,0x78,0x78,0x1C,0x1C,0x00,0x0C,0x09,0x09,0x00,0x0C,0xE0,0x73,0x0C,0x19,0x80,0xF0,0x0F,0x01,0xF8,0x39,0xC7,0x0C,0xE0,0x70,0x0C,0x09,0x09,0x00,0x0C,0xE0,0x77,0x0E,0x39,0xC1,0xB8,0x0F,0x00,0x60,0x06,0x00,0x60,0x06,0x00,0x0A,0x09,0x09,0x01,0x0C,0xFF,0xC0,0x70,0x30,0x38,0x1C,0x0E,0x07,0x03,0x80,0xFF,0xC0,0x04,0x0C,0x0B,0x01,0x06,0xFC,0xCC,0xCC,0xCC,0xCC,0xCF,0x07,0x0B,0x0A,0xFF,0x06,0xE0,0xC1,0x81,0x83,0x03,0x06,0x0C,0x0C,0x18,0x18,0x04,0x0C,0x0B,0x01,0x07,0xF3,0x33,0x33,0x33,0x33,0x3F,0x05,0x04,0x0A,0x01,0x06,0x23,0xB5,0x10,0x08,0x01,0x00,0x01,0x0A,0xFF,0x03,0x03,0x0A,0x00,0x04,0xCC,0x80,0x09,0x07,0x07,0x01,0x0A,0xFF,0x01,0x80,0x7F,0xFC,0x1E,0x0F,0xFE,0x09,0x0A,0x0A,0x01,0x0A,0xC0,0x60,0x30,0x1F,0xEC,0x1E,0x0F,0x07,0x83,0xC3,0xFF,0x80,0x08,0x07,0x07,0x01,0x09,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0x08,0x0A,0x0A,0x01,0x0B,0x03,0x03,0x03,0xFF,0xC3,0xC3,0xC3,0xC3,0xC3,0xFF,0x08,0x07,0x07,0x01,0x0A,0xFF,0xC3,0xC3,0xFF,0xC0,0xC0,0xFF,0x08,0x0A,0x0A,0x00,0x08,0x3F,0x61,0x60,0xFE,0x60,0x60,0x60,0x60,0x60,0x60,0x08,0x0A,0x07,0x01,0x0A,0xFF,0xC3,0xC3,0xC3,0xC3,0xC3,0xFF,0x03,0x83,0xFF,0x09,0x0A,0x0A,0x01,0x0A,0xC0,0x60,0x30,0x1F,0xEC,0x3E,0x0F,0x07,0x83,0xC1,0xE0,0xC0,0x02,0x0A,0x0A,0x01,0x04,0xF3,0xFF,0xF0,0x04,0x0D,0x0A,0xFF,0x04,0x33,0x03,0x33,0x33,0x33,0x33,0xF0,0x09,0x0A,0x0A,0x01,0x0A,0xC0,0x60,0x30,0x18,0xEC,0xC6,0xC3,0xE1,0xB8,0xC7,0x61,0xC0,0x02,0x0A,0x0A,0x01,0x04,0xFF,0xFF,0xF0,0x0D,0x07,0x07,0x01,0x0F,0xFF,0xF6,0x30,0xF1,0x87,0x8C,0x3C,0x61,0xE3,0x0F,0x18,0x60,0x09,0x07,0x07,0x01,0x0A,0xFF,0x61,0xF0,0x78,0x3C,0x1E,0x0F,0x06,0x08,0x07,0x07,0x01,0x0A,0xFF,0xC3,0xC3,0xC3,0xC3,0xC3,0xFF,0x09,0x0A,0x07,0x01,0x0A,0xFF,0x61,0xF0,0x78,0x3C,0x1E,0x1F,0xFD,0x80,0xC0,0x60,0x00,0x08,0x0A,0x07,0x01,0x0A,0xFF,0xC3,0xC3,0xC3,0xC3,0xC3,0xFF,0x03,0x03,0x03,0x07,0x07,0x07,0x01,0x08,0xFF,0x8B,0x06,0x0C,0x18,0x30,0x00,0x08,0x07,0x07,0x01,0x0A,0xFF,0xC0,0xC0,0xFF,0x03,0x03,0xFF,0x07,0x09,0x09,0x00,0x07,0x30,0x63,0xF9,0x83,0x06,0x0C,0x18,0x3E,0x08,0x07,0x07,0x01,0x0A,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xFF,0x09,0x07,0x07,0x00,0x09,0xE1,0xB1,0xD8,0xC6,0x63,0x60,0xF0,0x70,0x0E,0x07,0x07,0x00,0x0E,0xE7,0x1D,0x9E,0x66,0x79,0x99,0x6C,0x3C,0xB0,0xF3,0xC1,0x8E,0x00,0x09,0x07,0x07,0x00,0x09,0xE3,0xB9,0x8D,0x83,0x81,0xE3,0xBB,0x8E,0x0A,0x0A,0x07,0xFF,0x09,0x70,0xCC,0x73,0x18,0x66,0x1B,0x03,0xC0,0xE0,0x18,0x7C,0x3E,0x00,0x08,0x07,0x07,0x01,0x0A,0xFF,0x06,0x0C,0x38,0x70,0xE0,0xFF,0x04,0x0C,0x0B,0x01,0x06,0x76,0x66,0x6C,0xE6,0x66,0x67,0x02,0x0B,0x09,0x01,0x04,0xFF,0xFF,0xFC,0x04,0x0C,0x0B,0x01,0x06,0xC6,0x66,0x63,0x66,0x66,0x6E,0x06,0x02,0x04,0x00,0x06,0x76,0x70 };
+
+
+/***************************************************************************************************
+** Source Font      : Font Awesome 7 Free-Solid-900.otf
+** Font Size        : 16
+** Total Bytes      : 475
+** Character Count  : 8
+** Font Format Type : C9 (page index)
+** Create Time      : Sat Oct 17 00:15:12 2026
+** Note             : Font_Awesome_Free_Solid_16 (C8) with the page index, the icons are spread
+**                    over three 256 code point pages (0xF0xx, 0xF1xx, 0xF2xx). The range table
+**                    keeps only the longest range (battery icons 0xF240-0xF244).
+****************************************************************************************************/
+static const uint8_t Font_Awesome_Free_Solid_16_C9P[]={ 0xC9,0x09,0x10,0x08,0x00,0x01,0x00,0x21,0x00,0x40,0xF2,0x00,0x00,0x05,0x00,0x03,0x00,0xBD,0x00,0xDE,0x00,0x03,0x01,0x31,0x01,0x53,0x01,0x75,0x01,0x97,0x01,0xB9,0x01,0xF0,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x08,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x10,0x0E,0x00,0x0E,0x03,0x00,0x1E,0x01,0xFE,0x07,0xF8,0x3F,0xF0,0xFF,0xC3,0xFF,0x0F,0xFC,0x3F,0xF1,0xFF,0xE7,0xFF,0xBF,0xFF,0xFF,0xFC,0x00,0x00,0x78,0x00,0xC0,0x12,0x0E,0x0D,0x00,0x12,0x07,0xF8,0x07,0xFF,0x83,0xC0,0xF3,0xC0,0x0F,0xC0,0x00,0xC0,0x00,0x00,0x7F,0x80,0x3F,0xF0,0x0C,0x0C,0x02,0x01,0x00,0x00,0x00,0x03,0x00,0x01,0xE0,0x00,0x30,0x00,0x12,0x12,0x0F,0x00,0x12,0xC0,0x00,0x38,0x30,0x07,0x1E,0x00,0xFF,0xE0,0x1F,0xF8,0x03,0xFF,0x00,0x7F,0xC0,0x0F,0xF0,0x09,0xFC,0x03,0x3F,0x01,0xE7,0xE0,0x7C,0xF8,0x3F,0x9F,0x0F,0xF3,0xC0,0x00,0x70,0x07,0x8E,0x00,0xC1,0xC0,0x00,0x30,0x13,0x0C,0x0C,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x67,0xFE,0x6D,0xFF,0xEF,0xBF,0xFD,0xF7,0xFF,0xBE,0xFF,0xF7,0xCF,0xFC,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0,0x13,0x0C,0x0C,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x67,0xF0,0x6D,0xFF,0x0F,0xBF,0xE1,0xF7,0xFC,0x3E,0xFF,0x87,0xCF,0xE0,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0,0x13,0x0C,0x0C,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x67,0xC0,0x6D,0xFC,0x0F,0xBF,0x81,0xF7,0xF0,0x3E,0xFE,0x07,0xCF,0x80,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0,0x13,0x0C,0x0C,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x66,0x00,0x6D,0xE0,0x0F,0xBC,0x01,0xF7,0x80,0x3E,0xF0,0x07,0xCC,0x00,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0,0x13,0x0C,0x0B,0x01,0x14,0x7F,0xFF,0x9F,0xFF,0xFB,0x00,0x03,0x60,0x00,0x6C,0x00,0x0F,0x80,0x01,0xF0,0x00,0x3E,0x00,0x07,0xC0,0x00,0xD8,0x00,0x1B,0xFF,0xFF,0x3F,0xFF,0xC0 };
+
+
+
+
+
+
+
+#ifdef __cplusplus
+	}//extern "C"
+#endif
+#endif
@@ -1,10 +1,88 @@
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include "lfc_font.h"
 
 
 
 
+// UTF-8 sequence length by lead byte bits 7-3 (lead bytes 0x80-0xFF)
+// 0: continuation byte, 5: 0xF8-0xFF (5 and 6 byte leads, 0xFE and 0xFF are invalid)
+static const uint8_t _lfc_utf8_len[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 3, 3, 4, 5 };
+
+// Smallest code point of each sequence length, smaller values are overlong encodings
+static const uint32_t _lfc_utf8_min[7] = { 0, 0, 0x80, 0x800, 0x10000, 0x200000, 0x4000000 };
+
+// Longest UTF-8 sequence (RFC 2279)
+#define LFC_UTF8_MAX_LEN 6
+
+
+
+/**
+ * @brief Decodes one UTF-8 character to a code point
+ *
+ * @param str: Input UTF-8 encoded string
+ * @param avail: Readable bytes at str (LFC_UTF8_MAX_LEN for null-terminated strings)
+ * @param code: Output code point
+ *
+ * @return: UTF-8 byte length, 0 if error
+ *
+ * Same sequences as LFC_Utf8_To_Utf32 (1-6 bytes, overlong encodings and
+ * surrogates are rejected). ASCII returns before any table access, the
+ * length of a multi-byte sequence is read from a table instead of testing
+ * the lead byte against every pattern. A sequence longer than avail is an
+ * error, no byte after str[avail-1] is read.
+ */
+
+static inline uint8_t _LFC_Utf8_Decode(const uint8_t * str, uint16_t avail, uint32_t * code) {
+
+	uint32_t c = str[0];
+
+	// ASCII
+	if (c < 0x80) {
+		*code = c;
+		return 1;
+	}
+
+	uint8_t utf8_byte_len = _lfc_utf8_len[(c >> 3) & 0x0F];
+
+	if (utf8_byte_len == 5 && c >= 0xFC) {
+		utf8_byte_len = (c < 0xFE) ? 6 : 0;
+	}
+
+	// Check if utf8 valid start byte, truncated sequence
+	if (utf8_byte_len == 0 || utf8_byte_len > avail) {
+		return 0;
+	}
+
+	// Masked data bits
+	c &= 0xFF >> (utf8_byte_len + 1);
+
+	// Continuation bytes must be 10xxxxxx (a terminating zero fails the test)
+	for (uint8_t i = 1; i < utf8_byte_len; i++) {
+		uint8_t b = str[i];
+		if ((b & 0xC0) != 0x80) {
+			return 0;
+		}
+		c = (c << 6) | (b & 0x3F);
+	}
+
+	// Check overlong encoding
+	if (c < _lfc_utf8_min[utf8_byte_len]) {
+		return 0;
+	}
+
+	// Surrogate pair values are invalid in UTF-8
+	if ((c - 0xD800) < 0x800) {
+		return 0;
+	}
+
+	*code = c;
+	return utf8_byte_len;
+}
+
+
+
 /**
  * @brief Converts UTF-8 character codes to UTF-32 code (4-byte array)
  *        Supports 1-6 byte UTF-8 per RFC 2279.
@@ -37,92 +115,14 @@
 		return 0;
 	}
 
-	uint8_t i = 0;
-	uint8_t utf8_byte_len = 0;
-
-	// Clear UTF-32 output array (4 bytes)
-	for (uint8_t u = 0; u < 4; u++) {
-		u32_code[u] = 0;
-	}
-
-	// Check if character is ASCII
-	if ((*str) <= 127) {
-		u32_code[0] = *str;
-		return 1; // Return utf8 byte length
-	}
-
-	// --- Multi-byte UTF-8 processing ---
-
-	const uint8_t u8[5] = { 0xE0, 0xF0, 0xF8, 0xFC, 0xFE }; // Comparison masks
-	const uint8_t c8[5] = { 0xC0, 0xE0, 0xF0, 0xF8, 0xFC }; // Expected patterns
-
-	uint32_t test_code = 0;
-
-	utf8_byte_len = 0;
-
-	// Check utf8 byte count
-	for (i = 0; i < 5; i++) {
-		if ((*str & u8[i]) == c8[i]) {
-
-			// Utf-8 total byte length: i=0 2 bytes, i=4 6 bytes length
-			utf8_byte_len = i + 2;
-
-			// Masked data bits
-			test_code = (*str) & ( 0xFF >> ( i + 3 ));
-			break;
-		}
-	}
-
-	// Check if utf8 valid start byte
-	if (utf8_byte_len == 0) {
-		return 0; // UTF-8 start byte error
-	}
-
-	// First byte already processed, start from index 1 for continuation bytes
-	for (i = 1; i < utf8_byte_len; i++) {
-		str++;
-		// Check for string termination
-		if (*str == 0) {
-			return 0;
-		}
-		// Validate continuation byte format (must start with 10 binary)
-		if ((*str & 0xC0) != 0x80) {
-			return 0;
-		}
-
-		// Shift left 6-bit
-		test_code = (test_code << 6) | ((*str) & 0x3F);
-	}
-
-	// Check overlong encoding
-	switch(utf8_byte_len){
-		case 2:
-			if(test_code<0X80) return 0;
-			break;
-		case 3:
-			if(test_code<0X800) return 0;
-			break;
-		case 4:
-			if(test_code<0x10000) return 0;
-			break;
-		case 5:
-			if(test_code<0x200000) return 0;
-			break;
-		case 6:
-			if(test_code<0X4000000) return 0;
-			break;
-	}
-
-	// Surrogate pair values are invalid in UTF-8
-	if (test_code >= 0xD800 && test_code <= 0xDFFF) {
-	    return 0;
-	}
+	uint32_t code = 0;
+	uint8_t utf8_byte_len = _LFC_Utf8_Decode(str, LFC_UTF8_MAX_LEN, &code);
 
-	// Save little endian
-	for(int8_t j=0;j<4;j++){
-		u32_code[j] = test_code&0xFF;
-		test_code   = test_code>>8;
-	}
+	// Save little endian (zero on error)
+	u32_code[0] = code & 0xFF;
+	u32_code[1] = (code >> 8) & 0xFF;
+	u32_code[2] = (code >> 16) & 0xFF;
+	u32_code[3] = code >> 24;
 
 	// Return total bytes consumed from input string
 	return utf8_byte_len;
@@ -143,7 +143,7 @@
  */
 
 
-uint16_t LFC_Get_Chr_Index(const uint8_t * font, const uint8_t * u32_code, uint16_t character_count, uint8_t cmap_start) {
+LFC_OFFSET LFC_Get_Chr_Index(const uint8_t * font, const uint8_t * u32_code, uint16_t character_count, uint16_t cmap_start) {
 
 	// Check validate
 	if(font==NULL || u32_code==NULL){
@@ -151,28 +151,28 @@ uint16_t LFC_Get_Chr_Index(const uint8_t * font, const uint8_t * u32_code, uint1
 	}
 
 	int8_t i;
-	uint16_t ind = 0;
+	uint32_t ind = 0;
 	uint16_t cind = 0;
 
 
-	// Binary search
+	// Binary search (list_end is one past the last candidate, so it never wraps below 0)
 	uint16_t list_start;
 	uint16_t list_end;
 	uint16_t list_current;
 
     list_start=0;
-    list_end=character_count-1;
+    list_end=character_count;
 
-    while(list_end>=list_start){
+    while(list_end>list_start){
 
         list_current=list_start+(list_end-list_start)/2;
 
-        ind = cmap_start + list_current * 6;
+        ind = cmap_start + (uint32_t)list_current * 6;
 
 		// Compare 4-byte UTF-32 code with font entry
 		for (i = 3; i>-1 ; i--) {
 			if (u32_code[i] < font[ind + i]){
-				list_end = list_current-1;
+				list_end = list_current;
 				break;
 			}else if (u32_code[i] > font[ind + i]){
 				list_start=list_current+1;
@@ -230,944 +230,4802 @@ uint16_t LFC_Get_Chr_Index(const uint8_t * font, const uint8_t * u32_code, uint1
 
 
 /**
- * @brief Renders a single character to the display
- *
- * @param font: Pointer to font data array
- * @param ind: Index to character data in font
- * @param cx: Current X coordinate for rendering
- * @param cy: Current Y coordinate for rendering
- * @param pixel_fnc: Callback function to set individual pixels
+ * @brief Reads a little endian character data offset
  *
- * @return: Next X coordinate after rendering the character ( x + string width)
+ * @param p: Offset bytes
+ * @param size: Offset size (2, wide fonts: 4)
  *
- * This function reads character bitmap data from font and renders it
- * pixel by pixel using the provided callback function. It handles
- * coordinate transformation and clipping automatically.
+ * @return: Offset
  */
 
-static int16_t _LFC_Print_Chr(PRINT_FORM * print_form,uint16_t ind, int16_t cx, int16_t cy) {
-
-	// Check validate
-	if(print_form==NULL){
-		return 0;
-	}
-
-	// Check validate
-	if(print_form->font==NULL || print_form->display_context==NULL){
-		return 0;
+static LFC_OFFSET _LFC_Read_Offset(const uint8_t * p, uint8_t size) {
+	LFC_OFFSET offset = p[0] | ((uint16_t)p[1] << 8);
+#ifndef LFC_OFFSET_16
+	if(size == 4){
+		offset |= ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
 	}
+#else
+	(void)size;
+#endif
+	return offset;
+}
 
 
-	uint8_t invert=print_form->config & LFC_INVERT;
-
-	const uint8_t *font=print_form->font;
 
-	DISPLAY_CONTEXT *display_context = print_form->display_context;
+/**
+ * @brief Returns font bytes of a font handle
+ *
+ * @param font_handle: Font handle (font array or font source)
+ * @param offset: Font offset
+ * @param length: Byte count (up to 12 for values that can cross a source block)
+ *
+ * @return: Bytes, for a font source valid until the next read of the source
+ */
 
-	CB_Set_Pixel set_pixel_fnc = display_context->set_pixel_func;
+static const uint8_t * _LFC_Font_Bytes(const LFC_FONT * font_handle, LFC_OFFSET offset, uint16_t length) {
 
-	// Check validate
-	if(set_pixel_fnc==NULL){
-		return 0;
+	if(font_handle->source != NULL){
+		return LFC_Source_Read(font_handle->source, offset, length);
 	}
 
-	// Display context properties
-	uint16_t screen_width;
-	uint16_t screen_height;
-	uint8_t  screen_rotation  = display_context->rotation;
+	return &font_handle->data[offset];
+}
 
 
-	if((screen_rotation&0x1) == 0x01){
-		screen_height     = display_context->width; //change width to height
-		screen_width      = display_context->height; //change height to width
-	}else{
-		screen_width      = display_context->width;
-		screen_height     = display_context->height;
-	}
 
+/**
+ * @brief Returns the header length read by the library for a font format
+ *
+ * @param signature: First font byte
+ * @param header_size: Second font byte (header size of the font)
+ *
+ * @return: 5 (C8), 7 (C9), 9 or 11 (C9 with page index, 16 or 32-bit offset),
+ *          0: unknown signature
+ */
 
-	int16_t x = 0, y = 0;
+static uint8_t _LFC_Header_Len(uint8_t signature, uint8_t header_size) {
 
-	uint8_t reverse_x=0;
-	uint8_t reverse_y=0;
+	uint8_t offset_size = 2;
 
+#ifndef LFC_OFFSET_16
+	if(signature==LFC_C8W_FONT_SIGNATURE){
+		return LFC_C8_FONT_HEADER_LEN;
+	}
+	if(signature==LFC_C9W_FONT_SIGNATURE){
+		offset_size = 4;
+		signature   = LFC_C9_FONT_SIGNATURE;
+	}
+#endif
 
-	// 180 degree and 270 degree
-	if((screen_rotation&0x03)==0x02 || (screen_rotation&0x03)==0x03){
-		reverse_x=1;
+	if(signature==LFC_C8_FONT_SIGNATURE){
+		return LFC_C8_FONT_HEADER_LEN;
+	}
+	if(signature!=LFC_C9_FONT_SIGNATURE){
+		return 0;
 	}
 
-	// 0 degree and 270 degree
-	if((screen_rotation&0x03)==0x00 || (screen_rotation&0x03)==0x03){
-		reverse_y=1;
+	// Page index offset follows the C9 header fields
+	if(header_size >= LFC_C9_FONT_HEADER_LEN + offset_size){
+		return LFC_C9_FONT_HEADER_LEN + offset_size;
 	}
 
+	return LFC_C9_FONT_HEADER_LEN;
+}
+
 
-	// Character bitmap info
-	uint8_t bitmap_height;
-	uint8_t bitmap_width;
-	int8_t  bitmap_top;
-	int8_t  bitmap_left;
-	uint8_t advance;
-	uint8_t bit_status;
 
+/**
+ * @brief Reads the font header into a font handle (no validation)
+ *
+ * @param font_handle: Font handle with data or source set
+ *
+ * @return: 0: Success
+ * 			2: Error signature, format error
+ *
+ * Only the header of the font format is read. It is parsed from a copy
+ * because the page index header read can replace the source block.
+ */
 
-	// Read character properties from character header
-	bitmap_width  = font[ind++]; // Bitmap width in pixels
-	bitmap_height = font[ind++]; // Bitmap height in pixels
-	bitmap_top    = font[ind++]; // Bitmap top in pixel from origin
-	bitmap_left	  = font[ind++]; // Bitmap left in pixel from origin
-	advance       = font[ind++]; // character width
+static uint8_t _LFC_Parse_Header(LFC_FONT * font_handle) {
 
+	// Signature and header size first, they give the header length
+	const uint8_t *start = _LFC_Font_Bytes(font_handle, 0, 2);
+	uint8_t header_len   = _LFC_Header_Len(start[0], start[1]);
 
-	cx +=bitmap_left;
+	if(header_len==0){
+		return 2; // Invalid font signature
+	}
 
-	int16_t min_x,max_x;
-	int16_t min_y,max_y;
+	uint8_t font[LFC_C9W_PAGED_HEADER_LEN];
+	memcpy(font, _LFC_Font_Bytes(font_handle, 0, header_len), header_len);
 
+	uint8_t format      = font[0];
+	uint8_t offset_size = 2;
 
-	if(reverse_x){
-		int16_t rx = screen_width  - cx;
-		min_x=rx-bitmap_width;
-		max_x=rx;
-	}else{
-		min_x=cx;
-		max_x=cx+bitmap_width;
+#ifndef LFC_OFFSET_16
+	// Wide variants: same layout with 4-byte offsets
+	if(format==LFC_C8W_FONT_SIGNATURE || format==LFC_C9W_FONT_SIGNATURE){
+		format      = (format==LFC_C8W_FONT_SIGNATURE) ? LFC_C8_FONT_SIGNATURE : LFC_C9_FONT_SIGNATURE;
+		offset_size = 4;
 	}
+#endif
 
-	int16_t chr_top=bitmap_height-bitmap_top;
-	if(reverse_y){
-		int16_t ry = screen_height - cy + chr_top;
-		min_y=ry - bitmap_height;
-		max_y=ry;
-	}else{
-		int16_t ry = cy - chr_top;
-		min_y=ry;
-		max_y=ry + bitmap_height;
+	if(format!=LFC_C8_FONT_SIGNATURE && format!=LFC_C9_FONT_SIGNATURE){
+		return 2; // Invalid font signature
 	}
 
-	//Check if character is completely outside screen horizontally
-	if (((max_x < 0) && (min_x < 0))||((max_x > screen_width) && (min_x > screen_width))) {
-
-		if(advance>bitmap_width){
-			return cx + advance;
-		}
-		return cx + bitmap_width;
+	uint8_t header_size = font[1]; // Header size in bytes
+
+	font_handle->generation      = (font_handle->source != NULL) ? font_handle->source->generation : 0;
+	font_handle->format          = format;
+	font_handle->offset_size     = offset_size;
+	font_handle->height          = font[2];                        // Font height in pixels
+	font_handle->character_count = font[3] | ((uint16_t)font[4] << 8); // Little-endian 16-bit value
+	font_handle->cmap            = header_size;                    // Character map starts immediately after header
+	font_handle->missing_width   = MISSING_CHAR_SIZE(font_handle->height);
+
+	if(format==LFC_C9_FONT_SIGNATURE){
+		// Range table, then the offset table
+		font_handle->range_count   = font[5] | ((uint16_t)font[6] << 8);
+		font_handle->offsets       = font_handle->cmap + (uint32_t)font_handle->range_count * LFC_C9_RANGE_SIZE;
+		font_handle->offset_stride = offset_size;
+		font_handle->glyphs        = font_handle->offsets + (uint32_t)font_handle->character_count * offset_size;
+	}else{
+		// Offsets are in the character map entries, after the 4-byte code
+		font_handle->range_count   = 0;
+		font_handle->offsets       = font_handle->cmap + 4;
+		font_handle->offset_stride = 4 + offset_size;
+		font_handle->glyphs        = font_handle->cmap + (uint32_t)font_handle->character_count * font_handle->offset_stride;
 	}
 
-	//Check if character is completely outside screen vertically
-	if (((max_y < 0) && (min_y < 0))||((max_y > screen_height) && (min_y > screen_height))) {
-
-		if(advance>bitmap_width){
-			return cx + advance;
+	// Optional C9 page index
+	font_handle->page_table  = 0;
+	font_handle->page_blocks = 0;
+	font_handle->first_page  = 0;
+	font_handle->page_count  = 0;
+
+	if(header_len > LFC_C9_FONT_HEADER_LEN){
+		LFC_OFFSET index_offset = _LFC_Read_Offset(&font[7], offset_size);
+		if(index_offset){
+			const uint8_t *index = _LFC_Font_Bytes(font_handle, index_offset, LFC_C9_PAGE_HEADER_SIZE);
+			font_handle->first_page  = index[0] | ((uint16_t)index[1] << 8);
+			font_handle->page_count  = index[2] | ((uint16_t)index[3] << 8);
+			uint16_t block_count     = index[4] | ((uint16_t)index[5] << 8);
+			font_handle->page_table  = index_offset + LFC_C9_PAGE_HEADER_SIZE;
+			font_handle->page_blocks = font_handle->page_table + (uint32_t)font_handle->page_count * 2;
+			font_handle->glyphs      = font_handle->page_blocks + (uint32_t)block_count * LFC_C9_PAGE_BLOCK_SIZE;
 		}
-		return cx + bitmap_width;
 	}
 
+	// Direct index is set up by LFC_Load_Font
+	font_handle->direct_first    = 0;
+	font_handle->direct_start    = 0;
+	font_handle->direct_count    = 0;
 
+	// Number characters and tabular cells are set up by LFC_Load_Font
+	font_handle->number_ready    = 0;
+	font_handle->digit_advance   = 0;
+	font_handle->max_advance     = 0;
 
-	// Iterate through each pixel in character bitmap
-	for (y = min_y; y < max_y; y++) {
-
-		// Check reserve y axis
-		uint16_t fy;
-		if(!reverse_y){
-			fy = max_y - y - 1;
-		}else{
-			fy = y - min_y;
-		}
-
-		uint16_t y_index = fy * bitmap_width;
-
-		for (x = min_x; x < max_x; x++) {
+	return 0;
+}
 
-			// Check reserve x axis
-			uint16_t fx;
-			if(reverse_x){
-				fx = max_x - x - 1;
-			}else{
-				fx = x - min_x;
-			}
 
 
-			uint16_t byte_index = (y_index + fx);
-			uint8_t  bit_index  = 7 - (byte_index & 0x07); // calculate bit address  font_index%8
-			byte_index = ind + (byte_index >> 3);          // calculate byte address font_index/8
+/**
+ * @brief Reads the C8 or C9 font header into a font handle (no validation)
+ *
+ * @param font: C8 or C9 font array (or a wide variant)
+ * @param font_handle: Output font handle
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error signature, format error
+ */
 
-			// Extract pixel value from bitmap data (1 bit per pixel)
-			bit_status=(font[byte_index] >> bit_index) & 0x01;
+static uint8_t _LFC_Parse_Font(const uint8_t * font, LFC_FONT * font_handle) {
 
+	if(font==NULL || font_handle==NULL){
+		return 1;
+	}
 
-			// Apply inversion if requested
-			if (invert) {
-				bit_status = !bit_status;
-			}
+	font_handle->data   = font;
+	font_handle->source = NULL;
 
-			// For kerning
-			if(bit_status==0 && invert==0) continue;
+	return _LFC_Parse_Header(font_handle);
+}
 
-			// Set pixel using callback function
-			if(screen_rotation&0x01){ // Change x and y axis
-				set_pixel_fnc(y, x, bit_status); // 90 and 270 degrees
-			}else{
-				set_pixel_fnc(x, y, bit_status); // 0 and 180 degrees
-			}
 
-		}
-	}
 
-	// Next cursor position
-	if(advance>bitmap_width){
-		return cx + advance;
-	}
-	return cx + bitmap_width;
+/**
+ * @brief Reads the UTF-32 code of a character map entry
+ *
+ * @param font_handle: Font handle (C8)
+ * @param entry: Entry index
+ *
+ * @return: UTF-32 code point (stored little endian)
+ */
 
+static uint32_t _LFC_Cmap_Code(const LFC_FONT * font_handle, uint16_t entry) {
+	const uint8_t *p = _LFC_Font_Bytes(font_handle, font_handle->cmap + (uint32_t)entry * font_handle->offset_stride, 4);
+	return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
 }
 
 
 
+/**
+ * @brief Reads the character data offset of a character
+ *
+ * @param font_handle: Font handle
+ * @param entry: Character index (character map entry or offset table index)
+ *
+ * @return: Character data offset in the font
+ */
 
+static LFC_OFFSET _LFC_Chr_Offset(const LFC_FONT * font_handle, uint16_t entry) {
+	const uint8_t *p = _LFC_Font_Bytes(font_handle, font_handle->offsets + (uint32_t)entry * font_handle->offset_stride, font_handle->offset_size);
+	return _LFC_Read_Offset(p, font_handle->offset_size);
+}
 
-static int16_t _LFC_Print(PRINT_FORM * print_form, const uint8_t * str, int16_t x, int16_t y) {
 
-	// Check validate
-	if(print_form==NULL || str==NULL){
-		return 1;
-	}
 
-	// Check validate
-	if(print_form->display_context==NULL || print_form->font==NULL){
-		return 1;
-	}
+#define LFC_NO_ENTRY 0XFFFF // Character index not found
 
 
-	const uint8_t * font=print_form->font;
-	uint8_t u32_code[4];
-	int16_t px, py;
-	px = x;
-	py = y;
 
-	const uint8_t* s = (uint8_t *)str;
+/**
+ * @brief Searches for a code point in the ranges of a C9 character map
+ *
+ * @param font_handle: Font handle (C9)
+ * @param code: UTF-32 character code
+ *
+ * @return: Character index (offset table index), LFC_NO_ENTRY if not found
+ *
+ * The ranges are sorted by their first code point. The binary search runs
+ * over the ranges, which are far fewer than the characters.
+ */
 
-	// Font header variables
-	uint16_t ind, cind;
-	uint8_t cmap_start;
-	uint8_t font_height;
-	uint8_t font_signature;
-	uint8_t header_size;
-	uint16_t character_count;
+static uint16_t _LFC_Range_Entry(const LFC_FONT * font_handle, uint32_t code) {
 
+	uint16_t list_start = 0;
+	uint16_t list_end   = font_handle->range_count;
 
-	// Parse font header to get font properties
-	ind = 0;
-	font_signature = font[ind++];
-	if (font_signature != LFC_C8_FONT_SIGNATURE) {
-		return 0; // Invalid font signature
-	}
+	while(list_end > list_start){
 
-	// Read font header structure
-	header_size = font[ind++];		// Header size in bytes
-	font_height = font[ind++];		// Font height in pixels
+		uint16_t list_current = list_start + (list_end - list_start) / 2;
+		const uint8_t *range  = _LFC_Font_Bytes(font_handle, font_handle->cmap + (uint32_t)list_current * LFC_C9_RANGE_SIZE, LFC_C9_RANGE_SIZE);
 
-	// Character count (stored as little-endian 16-bit value)
-	character_count = font[ind++];
-	character_count |= font[ind++] << 8;
+		uint32_t first = range[0] | ((uint32_t)range[1] << 8) | ((uint32_t)range[2] << 16) | ((uint32_t)range[3] << 24);
 
-	//Character map starts immediately after header
-	cmap_start = header_size;
+		if(code < first){
+			list_end = list_current;
+			continue;
+		}
 
-	// Process string character by character
-	while (*s) {
+		uint16_t length = range[4] | ((uint16_t)range[5] << 8);
 
-		// Handle newline character
-		if(*s=='\n'){
-			px=x;              // Return to left edge
-			py-=font_height+1; // Move to next line
-			s++;
+		if(code - first >= length){
+			list_start = list_current + 1;
 			continue;
 		}
 
-		// Convert UTF-8 to UTF-32 for font lookup
-		uint8_t u8_len = LFC_Utf8_To_Utf32(s, u32_code);
-		if (u8_len == 0) {
-			return 0; // Conversion error
-		} else {
-			s += u8_len;
-		}
+		uint16_t entry = range[6] | ((uint16_t)range[7] << 8);
+		return entry + (uint16_t)(code - first);
+	}
 
-		// Look up character in font character map
-		cind = LFC_Get_Chr_Index(font, u32_code, character_count, cmap_start);
+	return LFC_NO_ENTRY;
+}
 
-		if (cind) {
-			// Render character and advance X position
-			if(print_form->config & (LFC_SPACING)){
-				px = _LFC_Print_Chr(print_form,cind, px, py)+print_form->spacing;
-			}else{
-				px = _LFC_Print_Chr(print_form,cind, px, py);
-			}
 
-		}else{
-			// Unknown character; we use a rectangle instead of it.
-			uint8_t missing_char_width=MISSING_CHAR_SIZE(font_height);
-			if(missing_char_width>5){
-				LFC_RECT rect;
-				rect.x = px + 2;
-				rect.y = py;
-				rect.width  = missing_char_width-4;
-				rect.height = missing_char_width;
-				LFC_Draw_Rect(print_form->display_context,&rect,LFC_LINE,0);
-			}
-			px += missing_char_width; // Calculate space
-		}
-	}
 
-	return px; // Return next X position
+/**
+ * @brief Counts the set bits of a 32-bit value
+ */
+
+static uint8_t _LFC_Bit_Count(uint32_t bits) {
+	bits = bits - ((bits >> 1) & 0x55555555);
+	bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+	bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+	return (uint8_t)((bits * 0x01010101) >> 24);
 }
 
-/*
- * @brief Calculates the bounding rectangle for a string without rendering it
+
+
+/**
+ * @brief Reads the character index of a code point from a C9 page index group
  *
- * @param print_form: Font properties
- * @param str: UTF-8 encoded input string
- * @param x  : Starting X coordinate
- * @param y  : Starting Y coordinate
- * @param padding: Additional padding around the text
- * @param rect: Output rectangle structure
+ * @param group: Bitmap group of the code point (6 bytes of the page index block)
+ * @param code: UTF-32 character code
  *
- * @return: 0 on success, 1 on error
+ * @return: Character index (offset table index), LFC_NO_ENTRY if not in the block
  *
- * This function calculates the exact dimensions that a string would occupy
- * if rendered, useful for text layout, centering, and background drawing.
+ * Each group of 32 code points holds the character index of its first
+ * character and a bitmap, the bits below the code point count the
+ * characters before it in the group.
  */
-uint8_t LFC_Str_Rect(PRINT_FORM * print_form,const uint8_t * str, int16_t x, int16_t y,LFC_RECT *rect) {
 
-	if(print_form==NULL || str==NULL || rect==NULL){
-		return 1;
-	}
-
-	if(print_form->display_context==NULL || print_form->font==NULL){
-		return 1;
-	}
-
-	uint8_t u32_code[4];
-	uint8_t* s = (uint8_t *)str;
+static uint16_t _LFC_Group_Entry(const uint8_t * group, uint32_t code) {
 
-	const uint8_t * font=print_form->font;
-	uint8_t padding     =print_form->padding;
+	uint32_t bits = group[2] | ((uint32_t)group[3] << 8) | ((uint32_t)group[4] << 16) | ((uint32_t)group[5] << 24);
+	uint32_t bit  = (uint32_t)1 << (code & 31);
 
+	if(!(bits & bit)){
+		return LFC_NO_ENTRY;
+	}
 
-	// Font variables
-	uint16_t ind, cind;
-	uint8_t  cmap_start;
-	uint8_t  font_signature;
-	uint8_t  header_size;
-	uint8_t  font_height;
-	uint16_t character_count;
+	return (group[0] | ((uint16_t)group[1] << 8)) + _LFC_Bit_Count(bits & (bit - 1));
+}
 
-	int16_t px, py;
-	px = x;
-	py = y;
 
-	int16_t min_y, max_y;
 
+/**
+ * @brief Looks up a code point in the C9 page index
+ *
+ * @param font_handle: Font handle with a page index
+ * @param code: UTF-32 character code
+ *
+ * @return: Character index (offset table index), LFC_NO_ENTRY if not found
+ *
+ * Two table reads: the block of the page, then the bitmap group.
+ */
 
-	int16_t rect_width   = 0;
+static uint16_t _LFC_Page_Entry(const LFC_FONT * font_handle, uint32_t code) {
 
-	uint8_t chr_width    = 0;
-	uint8_t chr_height   = 0;
-	int8_t  chr_top      = 0;
-    int8_t  chr_left     = 0;
-	uint8_t chr_advance  = 0;
+	uint32_t page = (code >> 8) - font_handle->first_page; // Unsigned, pages below the table wrap to large values
 
+	if(page >= font_handle->page_count){
+		return LFC_NO_ENTRY;
+	}
 
+	const uint8_t *table = _LFC_Font_Bytes(font_handle, font_handle->page_table + page * 2, 2);
+	uint16_t block = table[0] | ((uint16_t)table[1] << 8);
 
-	// Parse font header (same as rendering function)
-	ind = 0;
-	font_signature = font[ind++];
-	if (font_signature != LFC_C8_FONT_SIGNATURE) {
-		return 1;
+	if(block == LFC_C9_NO_PAGE){
+		return LFC_NO_ENTRY;
 	}
 
-	header_size = font[ind++];
-	font_height = font[ind++];
-
-	character_count = font[ind++];
-	character_count |= font[ind++] << 8;
+	// Only the bitmap group of the code point is read
+	uint32_t group = (uint32_t)block * LFC_C9_PAGE_BLOCK_SIZE + ((code >> 5) & 7) * 6;
+	return _LFC_Group_Entry(_LFC_Font_Bytes(font_handle, font_handle->page_blocks + group, 6), code);
+}
 
-	cmap_start = header_size;
 
-	// Initialize rectangle
-	rect->height = 0;
-	rect->width = 0;
-	rect->x = px;
-	rect->y = py;
 
-	min_y = 32000; // Initialize with big value
-	max_y = py;
+/**
+ * @brief Searches for a code point in a C9 font without a direct index hit
+ *
+ * @param font_handle: Font handle (C9)
+ * @param code: UTF-32 character code
+ *
+ * @return: Offset to character data in font, 0 if not found
+ *
+ * The page index is used when the font has one, otherwise the ranges are
+ * searched.
+ */
+
+static LFC_OFFSET _LFC_Range_Chr_Index(const LFC_FONT * font_handle, uint32_t code) {
+
+	uint16_t entry;
+
+	if(font_handle->page_table){
+		entry = _LFC_Page_Entry(font_handle, code);
+	}else{
+		entry = _LFC_Range_Entry(font_handle, code);
+	}
+
+	if(entry == LFC_NO_ENTRY){
+		return 0;
+	}
+
+	return _LFC_Chr_Offset(font_handle, entry);
+}
+
+
+
+/**
+ * @brief Searches for UTF-32 character in the character map of a font handle
+ *
+ * @param font_handle: Font handle
+ * @param code: UTF-32 character code
+ *
+ * @return: Offset to character data in font, 0 if not found
+ *
+ * Code points in the contiguous range of the font handle are resolved
+ * with one subtraction and one read, the others with a binary search.
+ */
+
+static LFC_OFFSET _LFC_Font_Chr_Index(const LFC_FONT * font_handle, uint32_t code) {
+
+	// Contiguous range: entry index by subtraction (unsigned, codes below the range wrap to large values)
+	uint32_t i = code - font_handle->direct_first;
+
+	if(i < font_handle->direct_count){
+		return _LFC_Chr_Offset(font_handle, font_handle->direct_start + i);
+	}
+
+	if(font_handle->format == LFC_C9_FONT_SIGNATURE){
+		return _LFC_Range_Chr_Index(font_handle, code);
+	}
+
+	// Binary search over the character map entries (sorted by code point)
+	uint16_t list_start = 0;
+	uint16_t list_end   = font_handle->character_count;
+
+	while(list_end > list_start){
+
+		uint16_t list_current = list_start + (list_end - list_start) / 2;
+		uint32_t entry_code   = _LFC_Cmap_Code(font_handle, list_current);
+
+		if(code < entry_code){
+			list_end = list_current;
+		}else if(code > entry_code){
+			list_start = list_current + 1;
+		}else{
+			return _LFC_Chr_Offset(font_handle, list_current);
+		}
+	}
+
+	return 0;
+}
+
+
+
+/**
+ * @brief Calculates the cell width of a character (advance without spacing)
+ *
+ * @param font_handle: Font handle
+ * @param cind: Character data offset in the font
+ *
+ * @return: Cell width, the bitmap fits in it
+ */
+
+static uint8_t _LFC_Cell_Width(const LFC_FONT * font_handle, LFC_OFFSET cind) {
+
+	const uint8_t *header = _LFC_Font_Bytes(font_handle, cind, 5);
+
+	uint8_t width   = header[0];
+	uint8_t advance = header[4];
+	int16_t cell    = (int8_t)header[3] + ((advance > width) ? advance : width);
+
+	if(cell < width){
+		cell = width;
+	}
+	if(cell > 255){
+		cell = 255;
+	}
+
+	return (uint8_t)cell;
+}
+
+
+
+/**
+ * @brief Finds the tabular cell widths of a font (LFC_TABULAR_DIGITS, LFC_MONOSPACE)
+ *
+ * @param font_handle: Font handle (character map set up)
+ */
+
+static void _LFC_Font_Cells(LFC_FONT * font_handle) {
+
+	font_handle->digit_advance = 0;
+	font_handle->max_advance   = 0;
+
+	// Widest glyph of the font
+	for(uint16_t i = 0; i < font_handle->character_count; i++){
+		uint8_t cell = _LFC_Cell_Width(font_handle, _LFC_Chr_Offset(font_handle, i));
+
+		if(cell > font_handle->max_advance){
+			font_handle->max_advance = cell;
+		}
+	}
+
+	// Widest digit
+	for(uint8_t digit = '0'; digit <= '9'; digit++){
+		LFC_OFFSET cind = _LFC_Font_Chr_Index(font_handle, digit);
+
+		if(cind && _LFC_Cell_Width(font_handle, cind) > font_handle->digit_advance){
+			font_handle->digit_advance = _LFC_Cell_Width(font_handle, cind);
+		}
+	}
+}
+
+
+
+/**
+ * @brief Returns the font handle of a print form
+ *
+ * @param print_form: Font properties
+ * @param raw_font: Storage for the handle of a raw font array
+ *
+ * @return: Pre-parsed font handle of the print form, or the raw font array
+ *          parsed into raw_font. NULL if the print form has no valid font.
+ *
+ * A handle of a font source that was cleared after LFC_Load_Font_Source
+ * is stale, the header of the new font is parsed into raw_font instead.
+ */
+
+static const LFC_FONT * _LFC_Form_Font(const PRINT_FORM * print_form, LFC_FONT * raw_font) {
+
+	const LFC_FONT *font_handle = print_form->font_handle;
+
+	if(font_handle!=NULL){
+		// Font source rewritten after the handle was built, the tables of the handle are stale
+		if(font_handle->source!=NULL && font_handle->generation!=font_handle->source->generation){
+			raw_font->data   = NULL;
+			raw_font->source = font_handle->source;
+
+			if(_LFC_Parse_Header(raw_font)){
+				return NULL;
+			}
+			return raw_font;
+		}
+		return font_handle;
+	}
+
+	// Tabular cells are not measured here (cell width 0: glyphs stay proportional)
+	if(_LFC_Parse_Font(print_form->font, raw_font)){
+		return NULL;
+	}
+
+	return raw_font;
+}
+
+
+
+// Characters of the number print functions, in LFC_FONT number_chars order
+static const uint8_t _lfc_number_codes[LFC_NUMBER_CHARS] = {
+	'0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F','-','+','.',' '
+};
+
+// Indexes of the sign, point and padding characters
+#define LFC_NUMBER_MINUS 16
+#define LFC_NUMBER_SIGN  17
+#define LFC_NUMBER_POINT 18
+#define LFC_NUMBER_SPACE 19
+
+
+
+// Character bitmap placed on the rotated screen (used by the render functions)
+typedef struct{
+	const uint8_t *bitmap; // Character bitmap data (1 bit per pixel, MSB first)
+	uint8_t width;         // Bitmap width in pixels
+	uint8_t height;        // Bitmap height in pixels
+	uint16_t row_bits;     // Bits per bitmap row (width in font data, stride*8 in the glyph cache)
+	int16_t min_x, max_x;  // Bitmap box on the rotated screen
+	int16_t min_y, max_y;
+	uint8_t rotation;      // Display rotation 0-3
+	uint8_t mode;          // Draw mode (LFC_DRAW_SET, LFC_DRAW_INVERT, LFC_DRAW_PUNCH)
+}LFC_CHR_BITMAP;
+
+// Character draw modes
+#define LFC_DRAW_SET    0 // Set glyph pixels, background untouched
+#define LFC_DRAW_INVERT 1 // Clear glyph pixels, set background pixels
+#define LFC_DRAW_PUNCH  2 // Clear glyph pixels only, background is already filled (inverted bounding box)
+
+
+
+/**
+ * @brief Converts a rectangle from rotated screen coordinates to display coordinates
+ *
+ * @param display_context: Display properties
+ * @param rect: Rectangle in rotated screen coordinates (as used by LFC_Draw_Rect)
+ * @param t_rect: Output rectangle in display coordinates (before rotation)
+ */
+
+static void _LFC_Rect_To_Display(DISPLAY_CONTEXT * display_context, const LFC_RECT * rect, LFC_RECT * t_rect) {
+
+	uint8_t screen_rotation = display_context->rotation;
+
+	// Change x to y axis and width to height
+	if(screen_rotation&0x01){
+		t_rect->x=rect->y;
+		t_rect->y=rect->x;
+		t_rect->width=rect->height;
+		t_rect->height=rect->width;
+	}else{
+		t_rect->x=rect->x;
+		t_rect->y=rect->y;
+		t_rect->width=rect->width;
+		t_rect->height=rect->height;
+	}
+
+	// reverse y axis : 0 degree and 270 degree
+	if((screen_rotation&0x03)==0x00 || (screen_rotation&0x03)==0x03){
+		t_rect->y=display_context->height-(t_rect->y + t_rect->height);
+	}
+
+	// reverse x axis :180 degree and 270 degree
+	if((screen_rotation&0x03)==0x02 || (screen_rotation&0x03)==0x03){
+		t_rect->x=display_context->width-(t_rect->x + t_rect->width);
+	}
+}
+
+
+
+/**
+ * @brief Computes the visible window in display coordinates
+ *
+ * @param display_context: Display properties
+ * @param min_x, max_x: Output column range [min_x, max_x)
+ * @param min_y, max_y: Output row range [min_y, max_y)
+ *
+ * The window is the screen, intersected with the clip rectangle if the
+ * display context has one. It can be empty (min >= max).
+ */
+
+static void _LFC_Clip_Window(DISPLAY_CONTEXT * display_context, int16_t * min_x, int16_t * max_x, int16_t * min_y, int16_t * max_y) {
+
+	*min_x = 0;
+	*max_x = display_context->width;
+	*min_y = 0;
+	*max_y = display_context->height;
+
+	if(display_context->clip_rect==NULL){
+		return;
+	}
+
+	LFC_RECT t_rect;
+	_LFC_Rect_To_Display(display_context, display_context->clip_rect, &t_rect);
+
+	if(t_rect.x > *min_x){
+		*min_x = t_rect.x;
+	}
+	if(t_rect.x + t_rect.width < *max_x){
+		*max_x = t_rect.x + t_rect.width;
+	}
+	if(t_rect.y > *min_y){
+		*min_y = t_rect.y;
+	}
+	if(t_rect.y + t_rect.height < *max_y){
+		*max_y = t_rect.y + t_rect.height;
+	}
+}
+
+
+
+/**
+ * @brief Adds a drawn box to the damage rectangle of the display
+ *
+ * @param display_context: Display properties
+ * @param min_x, max_x: Column range [min_x, max_x), not empty
+ * @param min_y, max_y: Row range [min_y, max_y), not empty
+ *
+ * The damage rectangle is in display coordinates, so a partial flush can
+ * send the covered columns and pages directly. Nothing is done when the
+ * display context does not track damage.
+ */
+
+static void _LFC_Mark_Dirty(DISPLAY_CONTEXT * display_context, int16_t min_x, int16_t max_x, int16_t min_y, int16_t max_y) {
+
+	LFC_RECT *dirty = display_context->dirty_rect;
+
+	if(dirty==NULL){
+		return;
+	}
+
+	// Grow non-empty damage rectangle
+	if(dirty->width!=0 && dirty->height!=0){
+		if(dirty->x < min_x){
+			min_x = dirty->x;
+		}
+		if(dirty->x + dirty->width > max_x){
+			max_x = dirty->x + dirty->width;
+		}
+		if(dirty->y < min_y){
+			min_y = dirty->y;
+		}
+		if(dirty->y + dirty->height > max_y){
+			max_y = dirty->y + dirty->height;
+		}
+	}
+
+	dirty->x      = min_x;
+	dirty->y      = min_y;
+	dirty->width  = max_x - min_x;
+	dirty->height = max_y - min_y;
+}
+
+
+
+/**
+ * @brief Writes a horizontal run of pixels to the display
+ *
+ * @param display_context: Display properties
+ * @param x: Start X coordinate (display coordinates, after rotation)
+ * @param y: Y coordinate (display coordinates, after rotation)
+ * @param len: Run length in pixels
+ * @param c: Pixel color
+ *
+ * The run is clipped to the screen. It is written directly when the display
+ * has a frame buffer, with the span callback when the display driver
+ * provides one, otherwise pixel by pixel.
+ */
+
+static void _LFC_Set_Span(DISPLAY_CONTEXT * display_context, int16_t x, int16_t y, uint16_t len, uint8_t c) {
+
+	// Check if run is outside screen vertically
+	if(y < 0 || y >= (int16_t)display_context->height){
+		return;
+	}
+
+	// Clip run to screen horizontally
+	int16_t end_x = x + len;
+	if(x < 0){
+		x = 0;
+	}
+	if(end_x > (int16_t)display_context->width){
+		end_x = display_context->width;
+	}
+	if(end_x <= x){
+		return;
+	}
+
+	// Page-major frame buffer: all pixels of the run are on the same page
+	if(display_context->frame_buffer!=NULL){
+		uint8_t *p    = &display_context->frame_buffer[(y >> 3) * display_context->width + x];
+		uint8_t  mask = 1 << (y & 0x07);
+		if(c){
+			for(; x < end_x; x++){
+				*p++ |= mask;
+			}
+		}else{
+			mask = ~mask;
+			for(; x < end_x; x++){
+				*p++ &= mask;
+			}
+		}
+		return;
+	}
+
+	// Write the run with one call if the display driver supports it
+	if(display_context->set_span_func!=NULL){
+		display_context->set_span_func(x, y, end_x - x, c);
+		return;
+	}
+
+	for(; x < end_x; x++){
+		display_context->set_pixel_func(x, y, c);
+	}
+}
+
+
+
+/**
+ * @brief Fills a rectangle in the page-major frame buffer
+ *
+ * @param display_context: Display properties (frame_buffer must be set)
+ * @param min_x, max_x: Column range [min_x, max_x), already clipped to screen
+ * @param min_y, max_y: Row range [min_y, max_y), already clipped to screen
+ * @param c: Pixel color
+ *
+ * Every column of a page is written with one byte operation.
+ */
+
+static void _LFC_Fill_Page_Rect(DISPLAY_CONTEXT * display_context, int16_t min_x, int16_t max_x, int16_t min_y, int16_t max_y, uint8_t c) {
+
+	int16_t x, y, page_end;
+
+	for(y = min_y; y < max_y; y = page_end){
+
+		// Rows of the current page
+		page_end = (y & ~0x07) + 8;
+		if(page_end > max_y){
+			page_end = max_y;
+		}
+
+		uint8_t mask = (0xFF << (y & 0x07)) & (0xFF >> (7 - ((page_end - 1) & 0x07)));
+		uint8_t *p   = &display_context->frame_buffer[(y >> 3) * display_context->width + min_x];
+
+		if(c){
+			for(x = min_x; x < max_x; x++){
+				*p++ |= mask;
+			}
+		}else{
+			mask = ~mask;
+			for(x = min_x; x < max_x; x++){
+				*p++ &= mask;
+			}
+		}
+	}
+}
+
+
+
+/**
+ * @brief Counts leading zero bits of a 32-bit word
+ *
+ * @param word: Input word, must not be 0
+ *
+ * @return: Number of zero bits before the first set bit (MSB side)
+ *
+ * Uses the CLZ instruction on Cortex-M3 (CMSIS __CLZ or the GCC builtin,
+ * which compiles to the same instruction) and a portable loop elsewhere.
+ */
+
+static inline uint8_t _LFC_CLZ(uint32_t word) {
+#if defined(__CLZ)
+	return __CLZ(word);
+#elif defined(__GNUC__)
+	return __builtin_clz(word);
+#else
+	uint8_t n = 0;
+	while(!(word & 0x80000000UL)){
+		word <<= 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
+
+
+/**
+ * @brief Reverses bit order of a 32-bit word (bit 31 becomes bit 0)
+ */
+
+static inline uint32_t _LFC_Reverse_Bits(uint32_t word) {
+#if defined(__GNUC__) && (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__))
+	__asm__ ("rbit %0, %1" : "=r" (word) : "r" (word));
+	return word;
+#else
+	word = ((word >> 1) & 0x55555555UL) | ((word & 0x55555555UL) << 1);
+	word = ((word >> 2) & 0x33333333UL) | ((word & 0x33333333UL) << 2);
+	word = ((word >> 4) & 0x0F0F0F0FUL) | ((word & 0x0F0F0F0FUL) << 4);
+	word = ((word >> 8) & 0x00FF00FFUL) | ((word & 0x00FF00FFUL) << 8);
+	return (word >> 16) | (word << 16);
+#endif
+}
+
+
+
+/**
+ * @brief Reads up to 32 consecutive pixels from one character bitmap row
+ *
+ * @param chr: Character bitmap
+ * @param fx: First pixel column in the bitmap
+ * @param fy: Bitmap row
+ * @param n: Pixel count (1-32)
+ *
+ * @return: Pixels MSB first (bit 31 is column fx), unused bits are 0
+ *
+ * C8 bitmaps are a continuous MSB first bit stream (cached glyphs have
+ * byte aligned rows), so a row segment is loaded as one big-endian word
+ * and shifted into place. Only the bytes covered by the segment are read,
+ * never past the end of the bitmap.
+ */
+
+static uint32_t _LFC_Fetch_Row(const LFC_CHR_BITMAP * chr, uint16_t fx, uint16_t fy, uint8_t n) {
+
+	uint32_t bit_pos = (uint32_t)fy * chr->row_bits + fx;
+	const uint8_t *p = &chr->bitmap[bit_pos >> 3];
+	uint8_t shift    = bit_pos & 0x07;
+	uint8_t bytes    = (shift + n + 7) >> 3; // 1-5 bytes
+
+	uint32_t word = (uint32_t)p[0] << 24;
+	if(bytes > 1) word |= (uint32_t)p[1] << 16;
+	if(bytes > 2) word |= (uint32_t)p[2] << 8;
+	if(bytes > 3) word |= (uint32_t)p[3];
+
+	word <<= shift;
+	if(bytes > 4) word |= p[4] >> (8 - shift);
+
+	// Clear bits after the segment
+	if(n < 32){
+		word &= ~(0xFFFFFFFFUL >> n);
+	}
+
+	return word;
+}
+
+
+
+/**
+ * @brief Transposes an 8x8 pixel block (rows to page columns)
+ *
+ * @param rows: Input, rows[i] is page row i, MSB is the first column
+ * @param cols: Output, cols[c] is column c, bit i is page row i
+ */
+
+static void _LFC_Transpose_8x8(const uint8_t * rows, uint8_t * cols) {
+
+	uint32_t x, y, t;
+
+	// Pack rows, last row in the top byte
+	x = ((uint32_t)rows[7] << 24) | ((uint32_t)rows[6] << 16) | ((uint32_t)rows[5] << 8) | rows[4];
+	y = ((uint32_t)rows[3] << 24) | ((uint32_t)rows[2] << 16) | ((uint32_t)rows[1] << 8) | rows[0];
+
+	// Swap 1x1, 2x2 and 4x4 sub blocks
+	t = (x ^ (x >> 7)) & 0x00AA00AAUL;  x = x ^ t ^ (t << 7);
+	t = (y ^ (y >> 7)) & 0x00AA00AAUL;  y = y ^ t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCCUL; x = x ^ t ^ (t << 14);
+	t = (y ^ (y >> 14)) & 0x0000CCCCUL; y = y ^ t ^ (t << 14);
+	t = (x & 0xF0F0F0F0UL) | ((y >> 4) & 0x0F0F0F0FUL);
+	y = ((x << 4) & 0xF0F0F0F0UL) | (y & 0x0F0F0F0FUL);
+	x = t;
+
+	cols[0] = x >> 24; cols[1] = x >> 16; cols[2] = x >> 8; cols[3] = x;
+	cols[4] = y >> 24; cols[5] = y >> 16; cols[6] = y >> 8; cols[7] = y;
+}
+
+
+
+/**
+ * @brief Writes runs of one display row segment
+ *
+ * @param display_context: Display properties
+ * @param word: Pixels MSB first (bit 31 is px), not inverted
+ * @param n: Pixel count (1-32)
+ * @param px: First X coordinate (display coordinates, after rotation)
+ * @param py: Y coordinate (display coordinates, after rotation)
+ * @param mode: Draw mode (LFC_DRAW_SET, LFC_DRAW_INVERT, LFC_DRAW_PUNCH)
+ *
+ * Runs of set pixels are found with count leading zeros. Every run is
+ * written with one span. When inverted, the whole segment is filled with
+ * one span first and only the set pixel runs are cleared.
+ */
+
+static void _LFC_Write_Row_Runs(DISPLAY_CONTEXT * display_context, uint32_t word, uint8_t n, int16_t px, int16_t py, uint8_t mode) {
+
+	uint8_t pos = 0;
+	uint8_t run;
+	uint8_t color = (mode == LFC_DRAW_SET);
+
+	// Inverted: fill background of the segment
+	if(mode == LFC_DRAW_INVERT){
+		_LFC_Set_Span(display_context, px, py, n, 1);
+	}
+
+	// Drop pixels after the segment
+	if(n < 32){
+		word &= ~(0xFFFFFFFFUL >> n);
+	}
+
+	while(word){
+
+		// Skip clear pixels
+		run = _LFC_CLZ(word);
+		pos += run;
+		word <<= run;
+
+		// Set pixels
+		run = (~word) ? _LFC_CLZ(~word) : 32;
+		_LFC_Set_Span(display_context, px + pos, py, run, color);
+		pos += run;
+		word = (run < 32) ? word << run : 0;
+	}
+}
+
+
+
+/**
+ * @brief Writes one display column segment to a page-major frame buffer
+ *
+ * @param p: Frame buffer byte of the first page
+ * @param width: Frame buffer width (bytes per page)
+ * @param bits: Pixels LSB first, already shifted to the page row
+ * @param mask: Rows covered by the segment, same alignment as bits
+ * @param pages: Number of pages covered by the segment
+ * @param mode: Draw mode (LFC_DRAW_SET, LFC_DRAW_INVERT, LFC_DRAW_PUNCH)
+ */
+
+static void _LFC_Write_Page_Column(uint8_t * p, uint16_t width, uint32_t bits, uint32_t mask, uint8_t pages, uint8_t mode) {
+
+	if(mode == LFC_DRAW_INVERT){
+		bits = ~bits & mask;
+		for(; pages; pages--, p += width){
+			*p = (*p & ~(uint8_t)mask) | (uint8_t)bits;
+			bits >>= 8;
+			mask >>= 8;
+		}
+	}else if(mode == LFC_DRAW_PUNCH){
+		for(; pages; pages--, p += width){
+			*p &= ~(uint8_t)bits;
+			bits >>= 8;
+		}
+	}else{
+		for(; pages; pages--, p += width){
+			*p |= (uint8_t)bits;
+			bits >>= 8;
+		}
+	}
+}
+
+
+
+// Character render kernel: one per display rotation and output type
+typedef void (*LFC_CHR_KERNEL)(DISPLAY_CONTEXT * display_context, const LFC_CHR_BITMAP * chr, int16_t px_min, int16_t px_max, int16_t py_min, int16_t py_max);
+
+
+
+/*
+ * Span kernels: render a character box row by row through the span (or pixel)
+ * callback. Each display row is read up to 32 pixels at a time.
+ */
+
+// 0 degree: display row is a bitmap row
+static void _LFC_Span_Kernel_0(DISPLAY_CONTEXT * display_context, const LFC_CHR_BITMAP * chr, int16_t px_min, int16_t px_max, int16_t py_min, int16_t py_max) {
+	for(int16_t py = py_min; py < py_max; py++){
+		uint16_t fy = py - chr->min_y;
+		for(int16_t px = px_min; px < px_max; px += 32){
+			uint8_t n = (px_max - px) > 32 ? 32 : (px_max - px);
+			_LFC_Write_Row_Runs(display_context, _LFC_Fetch_Row(chr, px - chr->min_x, fy, n), n, px, py, chr->mode);
+		}
+	}
+}
+
+// 90 degree: display row is a bitmap column, bottom to top
+// 8x8 blocks of bitmap rows are transposed to display rows
+static void _LFC_Span_Kernel_1(DISPLAY_CONTEXT * display_context, const LFC_CHR_BITMAP * chr, int16_t px_min, int16_t px_max, int16_t py_min, int16_t py_max) {
+	for(int16_t py = py_min; py < py_max; py += 8){
+		uint8_t nr = (py_max - py) > 8 ? 8 : (py_max - py);
+		uint16_t fx = py - chr->min_x;
+		for(int16_t px = px_min; px < px_max; px += 32){
+			uint8_t n = (px_max - px) > 32 ? 32 : (px_max - px);
+			uint32_t words[8] = {0};
+			for(uint8_t k = 0; k < n; k += 8){
+				uint8_t nc = (n - k) > 8 ? 8 : (n - k);
+				uint8_t in[8] = {0};
+				uint8_t out[8];
+				for(uint8_t c = 0; c < nc; c++){
+					in[7 - c] = _LFC_Fetch_Row(chr, fx, chr->max_y - 1 - (px + k + c), nr) >> 24;
+				}
+				_LFC_Transpose_8x8(in, out);
+				for(uint8_t r = 0; r < nr; r++){
+					words[r] |= (uint32_t)out[r] << (24 - k);
+				}
+			}
+			for(uint8_t r = 0; r < nr; r++){
+				_LFC_Write_Row_Runs(display_context, words[r], n, px, py + r, chr->mode);
+			}
+		}
+	}
+}
+
+// 180 degree: display row is a bitmap row, right to left
+static void _LFC_Span_Kernel_2(DISPLAY_CONTEXT * display_context, const LFC_CHR_BITMAP * chr, int16_t px_min, int16_t px_max, int16_t py_min, int16_t py_max) {
+	for(int16_t py = py_min; py < py_max; py++){
+		uint16_t fy = chr->max_y - 1 - py;
+		for(int16_t px = px_min; px < px_max; px += 32){
+			uint8_t n = (px_max - px) > 32 ? 32 : (px_max - px);
+			uint32_t word = _LFC_Reverse_Bits(_LFC_Fetch_Row(chr, chr->max_x - px - n, fy, n)) << (32 - n);
+			_LFC_Write_Row_Runs(display_context, word, n, px, py, chr->mode);
+		}
+	}
+}
+
+// 270 degree: display row is a bitmap column, top to bottom
+// 8x8 blocks of bitmap rows (right to left) are transposed to display rows
+static void _LFC_Span_Kernel_3(DISPLAY_CONTEXT * display_context, const LFC_CHR_BITMAP * chr, int16_t px_min, int16_t px_max, int16_t py_min, int16_t py_max) {
+	for(int16_t py = py_min; py < py_max; py += 8){
+		uint8_t nr = (py_max - py) > 8 ? 8 : (py_max - py);
+		uint16_t fx = chr->max_x - py - nr;
+		for(int16_t px = px_min; px < px_max; px += 32){
+			uint8_t n = (px_max - px) > 32 ? 32 : (px_max - px);
+			uint32_t words[8] = {0};
+			for(uint8_t k = 0; k < n; k += 8){
+				uint8_t nc = (n - k) > 8 ? 8 : (n - k);
+				uint8_t in[8] = {0};
+				uint8_t out[8];
+				for(uint8_t c = 0; c < nc; c++){
+					uint32_t word = _LFC_Fetch_Row(chr, fx, px + k + c - chr->min_y, nr);
+					in[7 - c] = _LFC_Reverse_Bits(word) << (8 - nr);
+				}
+				_LFC_Transpose_8x8(in, out);
+				for(uint8_t r = 0; r < nr; r++){
+					words[r] |= (uint32_t)out[r] << (24 - k);
+				}
+			}
+			for(uint8_t r = 0; r < nr; r++){
+				_LFC_Write_Row_Runs(display_context, words[r], n, px, py + r, chr->mode);
+			}
+		}
+	}
+}
+
+
+
+/*
+ * Page kernels: render a character box directly to a page-major frame buffer
+ * (SSD1306 layout, each byte holds 8 vertical pixels). The box must be
+ * clipped to the screen. Every column of a page is written with one OR
+ * (masked write when inverted, AND when punched into a filled box).
+ */
+
+// 0 degree: 8x8 blocks of bitmap rows are transposed to page columns
+static void _LFC_Page_Kernel_0(DISPLAY_CONTEXT * display_context, const LFC_CHR_BITMAP * chr, int16_t px_min, int16_t px_max, int16_t py_min, int16_t py_max) {
+
+	uint16_t width = display_context->width;
+	int16_t page_end;
+
+	for(int16_t py = py_min; py < py_max; py = page_end){
+
+		// Rows of the current page
+		page_end = (py & ~0x07) + 8;
+		if(page_end > py_max){
+			page_end = py_max;
+		}
+		uint8_t mask = (0xFF << (py & 0x07)) & (0xFF >> (7 - ((page_end - 1) & 0x07)));
+		uint8_t *p   = &display_context->frame_buffer[(py >> 3) * width + px_min];
+
+		for(int16_t px = px_min; px < px_max; px += 8){
+			uint8_t n = (px_max - px) > 8 ? 8 : (px_max - px);
+			uint8_t rows[8] = {0};
+			uint8_t cols[8];
+
+			for(int16_t y = py; y < page_end; y++){
+				rows[y & 0x07] = _LFC_Fetch_Row(chr, px - chr->min_x, y - chr->min_y, n) >> 24;
+			}
+			_LFC_Transpose_8x8(rows, cols);
+
+			for(uint8_t c = 0; c < n; c++, p++){
+				_LFC_Write_Page_Column(p, width, cols[c], mask, 1, chr->mode);
+			}
+		}
+	}
+}
+
+// 90 degree: display column is a bitmap row
+static void _LFC_Page_Kernel_1(DISPLAY_CONTEXT * display_context, const LFC_CHR_BITMAP * chr, int16_t px_min, int16_t px_max, int16_t py_min, int16_t py_max) {
+
+	uint16_t width = display_context->width;
+	int16_t chunk_end;
+
+	for(int16_t py = py_min; py < py_max; py = chunk_end){
+
+		// Rows of the current chunk, at most 32 bits after page alignment
+		chunk_end = (py & ~0x07) + 32;
+		if(chunk_end > py_max){
+			chunk_end = py_max;
+		}
+		uint8_t n     = chunk_end - py;
+		uint8_t shift = py & 0x07;
+		uint8_t pages = ((chunk_end - 1) >> 3) - (py >> 3) + 1;
+		uint32_t mask = ((n < 32) ? ((1UL << n) - 1) : 0xFFFFFFFFUL) << shift;
+		uint8_t *p    = &display_context->frame_buffer[(py >> 3) * width + px_min];
+
+		for(int16_t px = px_min; px < px_max; px++, p++){
+			uint32_t bits = _LFC_Reverse_Bits(_LFC_Fetch_Row(chr, py - chr->min_x, chr->max_y - 1 - px, n));
+			_LFC_Write_Page_Column(p, width, bits << shift, mask, pages, chr->mode);
+		}
+	}
+}
+
+// 180 degree: 8x8 blocks of bitmap rows (right to left, bottom to top) are transposed to page columns
+static void _LFC_Page_Kernel_2(DISPLAY_CONTEXT * display_context, const LFC_CHR_BITMAP * chr, int16_t px_min, int16_t px_max, int16_t py_min, int16_t py_max) {
+
+	uint16_t width = display_context->width;
+	int16_t page_end;
+
+	for(int16_t py = py_min; py < py_max; py = page_end){
+
+		// Rows of the current page
+		page_end = (py & ~0x07) + 8;
+		if(page_end > py_max){
+			page_end = py_max;
+		}
+		uint8_t mask = (0xFF << (py & 0x07)) & (0xFF >> (7 - ((page_end - 1) & 0x07)));
+		uint8_t *p   = &display_context->frame_buffer[(py >> 3) * width + px_min];
+
+		for(int16_t px = px_min; px < px_max; px += 8){
+			uint8_t n = (px_max - px) > 8 ? 8 : (px_max - px);
+			uint8_t rows[8] = {0};
+			uint8_t cols[8];
+
+			for(int16_t y = py; y < page_end; y++){
+				uint32_t word = _LFC_Fetch_Row(chr, chr->max_x - px - n, chr->max_y - 1 - y, n);
+				rows[y & 0x07] = _LFC_Reverse_Bits(word) << (8 - n);
+			}
+			_LFC_Transpose_8x8(rows, cols);
+
+			for(uint8_t c = 0; c < n; c++, p++){
+				_LFC_Write_Page_Column(p, width, cols[c], mask, 1, chr->mode);
+			}
+		}
+	}
+}
+
+// 270 degree: display column is a bitmap row, right to left
+static void _LFC_Page_Kernel_3(DISPLAY_CONTEXT * display_context, const LFC_CHR_BITMAP * chr, int16_t px_min, int16_t px_max, int16_t py_min, int16_t py_max) {
+
+	uint16_t width = display_context->width;
+	int16_t chunk_end;
+
+	for(int16_t py = py_min; py < py_max; py = chunk_end){
+
+		// Rows of the current chunk, at most 32 bits after page alignment
+		chunk_end = (py & ~0x07) + 32;
+		if(chunk_end > py_max){
+			chunk_end = py_max;
+		}
+		uint8_t n     = chunk_end - py;
+		uint8_t shift = py & 0x07;
+		uint8_t pages = ((chunk_end - 1) >> 3) - (py >> 3) + 1;
+		uint32_t mask = ((n < 32) ? ((1UL << n) - 1) : 0xFFFFFFFFUL) << shift;
+		uint8_t *p    = &display_context->frame_buffer[(py >> 3) * width + px_min];
+
+		for(int16_t px = px_min; px < px_max; px++, p++){
+			uint32_t bits = _LFC_Fetch_Row(chr, chr->max_x - py - n, px - chr->min_y, n) >> (32 - n);
+			_LFC_Write_Page_Column(p, width, bits << shift, mask, pages, chr->mode);
+		}
+	}
+}
+
+
+
+// Render kernels indexed by display rotation
+static const LFC_CHR_KERNEL _lfc_span_kernels[4] = { _LFC_Span_Kernel_0, _LFC_Span_Kernel_1, _LFC_Span_Kernel_2, _LFC_Span_Kernel_3 };
+static const LFC_CHR_KERNEL _lfc_page_kernels[4] = { _LFC_Page_Kernel_0, _LFC_Page_Kernel_1, _LFC_Page_Kernel_2, _LFC_Page_Kernel_3 };
+
+
+
+/**
+ * @brief Returns the bitmap of a character
+ *
+ * @param font_handle: Font handle (font array or font source)
+ * @param ind: Character data offset in the font
+ *
+ * @return: Bitmap (after the 5 byte character header), NULL if a font source could not read it
+ *
+ * A font source reads the character header and bitmap in one transaction,
+ * the bitmap is valid until the next read of the source.
+ */
+
+static const uint8_t * _LFC_Glyph_Bitmap(const LFC_FONT * font_handle, LFC_OFFSET ind) {
+
+	if(font_handle->source != NULL){
+		const uint8_t *chr = LFC_Source_Read_Glyph(font_handle->source, ind);
+		return (chr != NULL) ? chr + 5 : NULL;
+	}
+
+	return &font_handle->data[ind + 5];
+}
+
+
+
+/**
+ * @brief Finds a glyph in the cache, loads it on a miss
+ *
+ * @param cache: Glyph cache
+ * @param font_handle: Font of the glyph
+ * @param glyph: Shaped glyph (LFC_GLYPH_BITMAP)
+ *
+ * @return: Cache slot of the glyph, NULL if the glyph bitmap does not fit in a slot
+ *
+ * A missing glyph replaces the least recently used slot. Its bitmap is
+ * copied with byte aligned rows, so rows are read without bit offsets.
+ * Only visible glyphs are looked up, hidden ones do not evict slots.
+ */
+
+static LFC_CACHE_SLOT * _LFC_Cache_Glyph(LFC_GLYPH_CACHE * cache, const LFC_FONT * font_handle, const LFC_GLYPH * glyph) {
+
+	// Font arrays and font sources are told apart by their address
+	const void *font       = (font_handle->source != NULL) ? (const void *)font_handle->source : (const void *)font_handle->data;
+	LFC_OFFSET  ind        = glyph->offset;
+	uint32_t    generation = font_handle->generation; // Slots of a rewritten font source miss
+
+	LFC_CACHE_SLOT *slot = cache->slots;
+	LFC_CACHE_SLOT *lru  = slot;
+
+	// Check if cache is initialized
+	if(slot==NULL || cache->slot_count==0){
+		return NULL;
+	}
+
+	cache->clock++;
+
+	// Look up glyph, remember least recently used slot
+	for(uint8_t i = 0; i < cache->slot_count; i++, slot++){
+		if(slot->font == font && slot->ind == ind && slot->generation == generation){
+			slot->stamp = cache->clock;
+			cache->hits++;
+			return slot;
+		}
+		if(slot->stamp < lru->stamp){
+			lru = slot;
+		}
+	}
+
+	cache->misses++;
+
+	// Check if bitmap fits in a slot
+	uint8_t width  = glyph->width;
+	uint8_t height = glyph->height;
+	uint8_t stride = (width + 7) >> 3;
+
+	if((uint16_t)stride * height > cache->bitmap_size){
+		return NULL;
+	}
+
+	// Load glyph to the least recently used slot
+	LFC_CHR_BITMAP chr;
+	chr.bitmap   = _LFC_Glyph_Bitmap(font_handle, ind);
+	chr.width    = width;
+	chr.row_bits = width;
+
+	if(chr.bitmap == NULL){
+		return NULL;
+	}
+
+	uint8_t *bitmap = cache->bitmaps + (uint16_t)(lru - cache->slots) * cache->bitmap_size;
+
+	for(uint8_t fy = 0; fy < height; fy++){
+		for(uint16_t fx = 0; fx < width; fx += 32){
+			uint8_t n = (width - fx) > 32 ? 32 : (width - fx);
+			uint32_t word = _LFC_Fetch_Row(&chr, fx, fy, n);
+			for(uint8_t b = 0; b < n; b += 8){
+				*bitmap++ = word >> 24;
+				word <<= 8;
+			}
+		}
+	}
+
+	lru->font       = font;
+	lru->ind        = ind;
+	lru->generation = generation;
+	lru->stride     = stride;
+	lru->stamp      = cache->clock;
+
+	return lru;
+}
+
+
+
+/**
+ * @brief Checks if a glyph can be punched out of the filled bounding box
+ *
+ * @param punch: Free part of the filled box, right of the glyphs drawn so far
+ * @param x: Glyph box left
+ * @param y: Glyph box bottom
+ * @param width: Glyph box width
+ * @param height: Glyph box height
+ *
+ * @return: 1: Punch the glyph, 0: Draw it inverted
+ *
+ * Punching gives the pixels of an inverted draw only where the box is
+ * still filled. A glyph box reaching out of the free part (negative
+ * bearing or spacing, ink past the advance) is drawn inverted as before.
+ * The free part starts right of every glyph box drawn so far.
+ */
+
+static uint8_t _LFC_Punch_Box(LFC_RECT * punch, int16_t x, int16_t y, uint8_t width, uint8_t height) {
+
+	int16_t right = x + width;
+
+	uint8_t result = x >= punch->x && right <= punch->x + punch->width &&
+	                 y >= punch->y && y + height <= punch->y + punch->height;
+
+	if(width && right > punch->x){
+		punch->width = (right < punch->x + punch->width) ? punch->x + punch->width - right : 0;
+		punch->x = right;
+	}
+
+	return result;
+}
+
+
+
+/**
+ * @brief Shapes a character from its character data offset
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param cind: Character data offset in the font, 0: missing character
+ * @param glyph: Output glyph
+ */
+
+static void _LFC_Shape_Offset(const PRINT_FORM * print_form, const LFC_FONT * font_handle, LFC_OFFSET cind, LFC_GLYPH * glyph) {
+
+	glyph->offset  = 0;
+	glyph->top     = 0;
+	glyph->left    = 0;
+
+	if(cind){
+		const uint8_t *header = _LFC_Font_Bytes(font_handle, cind, 5);
+
+		// Read character metrics from character header
+		uint8_t advance = header[4]; // character width
+
+		glyph->type   = LFC_GLYPH_BITMAP;
+		glyph->offset = cind;
+		glyph->width  = header[0]; // Bitmap width in pixels
+		glyph->height = header[1]; // Bitmap height in pixels
+		glyph->top    = header[2]; // Bitmap top in pixel from origin
+		glyph->left   = header[3]; // Bitmap left in pixel from origin
+
+		if(advance > glyph->width){
+			glyph->advance = glyph->left + advance;
+		}else{
+			glyph->advance = glyph->left + glyph->width;
+		}
+
+		if(print_form->config & (LFC_SPACING)){
+			glyph->advance += print_form->spacing;
+		}
+	}else{
+		// Unknown character, drawn as a box of the missing character size
+		uint8_t missing_char_width = font_handle->missing_width;
+
+		glyph->type    = LFC_GLYPH_MISSING;
+		glyph->width   = missing_char_width;
+		glyph->height  = missing_char_width;
+		glyph->advance = missing_char_width;
+	}
+}
+
+
+
+/**
+ * @brief Gives a shaped glyph the fixed advance of the tabular modes
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param digit: 1 if the glyph is a digit 0-9
+ * @param glyph: Shaped glyph (bitmap or missing)
+ *
+ * The glyph box (left bearing and advance) is centered in the cell of the
+ * widest glyph (LFC_MONOSPACE) or the widest digit (LFC_TABULAR_DIGITS), so
+ * the bitmap keeps its bearing. The cells are measured by LFC_Load_Font,
+ * glyphs of a raw font array keep their own advance.
+ */
+
+static void _LFC_Tabular_Glyph(const PRINT_FORM * print_form, const LFC_FONT * font_handle, uint8_t digit, LFC_GLYPH * glyph) {
+
+	uint8_t cell;
+
+	if(print_form->tabular == LFC_MONOSPACE){
+		cell = font_handle->max_advance;
+	}else if(digit && print_form->tabular == LFC_TABULAR_DIGITS){
+		cell = font_handle->digit_advance;
+	}else{
+		return;
+	}
+
+	// Font handle without cells (raw font array)
+	if(cell==0){
+		return;
+	}
+
+	if(glyph->type == LFC_GLYPH_BITMAP){
+
+		// Own advance of the glyph without spacing (same as its cell width)
+		int16_t own = glyph->advance;
+		if(print_form->config & (LFC_SPACING)){
+			own -= print_form->spacing;
+		}
+
+		// Move the glyph by half of the free space, keep left in the int8_t range
+		int16_t left = glyph->left + ((int16_t)cell - own) / 2;
+		if(left < -128){
+			left = -128;
+		}
+		if(left > 127){
+			left = 127;
+		}
+		glyph->left = (int8_t)left;
+	}
+
+	glyph->advance = cell;
+
+	if(print_form->config & (LFC_SPACING)){
+		glyph->advance += print_form->spacing;
+	}
+}
+
+
+
+/**
+ * @brief Shapes one character code
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param code: UTF-32 character code
+ * @param glyph: Output glyph
+ *
+ * The character is looked up in the character map once, its metrics are
+ * copied into the glyph so it can be drawn or measured later without
+ * touching the text or the character map again.
+ */
+
+static void _LFC_Shape_Code(const PRINT_FORM * print_form, const LFC_FONT * font_handle, uint32_t code, LFC_GLYPH * glyph) {
+
+	// Handle newline character
+	if(code=='\n'){
+		glyph->offset  = 0;
+		glyph->advance = 0;
+		glyph->top     = 0;
+		glyph->left    = 0;
+		glyph->type    = LFC_GLYPH_NEWLINE;
+		glyph->width   = 0;
+		glyph->height  = font_handle->height;
+		return;
+	}
+
+	// Look up character in font character map
+	_LFC_Shape_Offset(print_form, font_handle, _LFC_Font_Chr_Index(font_handle, code), glyph);
+
+	if(print_form->tabular != LFC_PROPORTIONAL){
+		_LFC_Tabular_Glyph(print_form, font_handle, (code - '0') < 10, glyph);
+	}
+}
+
+
+
+// Text read by the print and measure loops, UTF-8 string or UTF-32 array
+typedef struct{
+	const uint8_t  * utf8;      // UTF-8 text, NULL: UTF-32 text
+	const uint8_t  * utf8_end;  // End of a length-bounded UTF-8 text, NULL: zero terminated
+	const uint8_t  * ascii_end; // End of the ASCII run found by _LFC_Ascii_Run (bounded text)
+	const uint32_t * utf32;     // UTF-32 code array
+	uint16_t length;            // Remaining UTF-32 codes
+}LFC_TEXT;
+
+// Results of _LFC_Next_Glyph
+#define LFC_TEXT_END   0 // End of text
+#define LFC_TEXT_GLYPH 1 // Glyph shaped
+#define LFC_TEXT_ERROR 2 // Conversion error (invalid UTF-8 sequence or UTF-32 code)
+
+
+static void _LFC_Text_Utf8(LFC_TEXT * text, const uint8_t * str) {
+	text->utf8      = str;
+	text->utf8_end  = NULL;
+	text->ascii_end = str;
+	text->utf32     = NULL;
+	text->length    = 0;
+}
+
+
+static void _LFC_Text_Utf8_N(LFC_TEXT * text, const uint8_t * str, uint16_t length) {
+	text->utf8      = str;
+	text->utf8_end  = str + length;
+	text->ascii_end = str;
+	text->utf32     = NULL;
+	text->length    = 0;
+}
+
+
+static void _LFC_Text_Utf32(LFC_TEXT * text, const uint32_t * str, uint16_t length) {
+	text->utf8      = NULL;
+	text->utf8_end  = NULL;
+	text->ascii_end = NULL;
+	text->utf32     = str;
+	text->length    = length;
+}
+
+
+
+/**
+ * @brief Length of the ASCII run at the start of a length-bounded text
+ *
+ * @param s: UTF-8 text
+ * @param len: Bytes in the text
+ *
+ * @return: Number of leading bytes in 0x01-0x7F (no zero byte, no multi-byte sequence)
+ *
+ * Tests 4 bytes per step: a byte in 0x01-0x7F keeps its top bit clear
+ * after subtracting 1, a zero byte borrows and a byte >= 0x80 has it set.
+ * Only bytes inside the text are read.
+ */
+
+static uint16_t _LFC_Ascii_Run(const uint8_t * s, uint16_t len) {
+
+	uint16_t n = 0;
+
+	while ((uint16_t)(len - n) >= 4) {
+		uint32_t w;
+		memcpy(&w, s + n, 4);
+		if (((w | (w - 0x01010101u)) & 0x80808080u) != 0) {
+			break;
+		}
+		n += 4;
+	}
+
+	while (n < len && (uint8_t)(s[n] - 1) < 0x7F) {
+		n++;
+	}
+
+	return n;
+}
+
+
+
+/**
+ * @brief Shapes the next character of a text
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param text: Text, moved past the character
+ * @param glyph: Output glyph
+ *
+ * @return: LFC_TEXT_GLYPH, LFC_TEXT_END or LFC_TEXT_ERROR (the text is not moved)
+ *
+ * Length-bounded text ends after its length or at a zero byte, a multi-byte
+ * sequence cut by the end is a conversion error. UTF-32 text ends after its
+ * length or at a zero code. Codes that have no UTF-8 encoding (surrogates,
+ * 0x80000000 and above) are conversion errors as their UTF-8 form would be.
+ */
+
+static uint8_t _LFC_Next_Glyph(const PRINT_FORM * print_form, const LFC_FONT * font_handle, LFC_TEXT * text, LFC_GLYPH * glyph) {
+
+	uint32_t code;
+
+	if(text->utf8!=NULL){
+
+		uint16_t avail = LFC_UTF8_MAX_LEN;
+
+		// Length-bounded text: find the next ASCII run when the last one is used up
+		if(text->utf8_end!=NULL && text->utf8>=text->ascii_end){
+			if(text->utf8>=text->utf8_end){
+				return LFC_TEXT_END;
+			}
+			avail = text->utf8_end - text->utf8;
+			text->ascii_end = text->utf8 + _LFC_Ascii_Run(text->utf8, avail);
+		}
+
+		if(text->utf8<text->ascii_end){
+
+			// ASCII run, no decoding
+			code = *text->utf8++;
+
+		}else{
+
+			if(*text->utf8==0){
+				return LFC_TEXT_END;
+			}
+
+			// Convert UTF-8 to UTF-32 for font lookup
+			uint8_t u8_len = _LFC_Utf8_Decode(text->utf8, avail, &code);
+			if (u8_len == 0) {
+				return LFC_TEXT_ERROR;
+			}
+			text->utf8 += u8_len;
+		}
+
+	}else{
+
+		if(text->length==0 || *text->utf32==0){
+			return LFC_TEXT_END;
+		}
+
+		code = *text->utf32;
+		if(code >= 0x80000000 || (code - 0xD800) < 0x800){
+			return LFC_TEXT_ERROR;
+		}
+		text->utf32++;
+		text->length--;
+	}
+
+	_LFC_Shape_Code(print_form, font_handle, code, glyph);
+
+	return LFC_TEXT_GLYPH;
+}
+
+
+
+/**
+ * @brief Renders a single shaped glyph to the display
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param glyph: Glyph with bitmap (LFC_GLYPH_BITMAP)
+ * @param cx: Current X coordinate for rendering
+ * @param cy: Current Y coordinate for rendering
+ * @param punch: Free part of the filled bounding box (inverted text), NULL: background is not filled
+ *
+ * This function reads character bitmap data from font (or from the glyph
+ * cache if the print form has one) and renders it
+ * directly to the frame buffer if the display has one, otherwise row by
+ * row as runs of same colored pixels.
+ * It handles coordinate transformation and clipping automatically.
+ */
+
+static void _LFC_Draw_Glyph(PRINT_FORM * print_form, const LFC_FONT * font_handle, const LFC_GLYPH * glyph, int16_t cx, int16_t cy, LFC_RECT * punch) {
+
+	// Check validate
+	if(print_form==NULL || font_handle==NULL){
+		return;
+	}
+
+	// Check validate
+	if(print_form->display_context==NULL){
+		return;
+	}
+
+
+	DISPLAY_CONTEXT *display_context = print_form->display_context;
+
+	// Check validate
+	if(display_context->set_pixel_func==NULL && display_context->frame_buffer==NULL){
+		return;
+	}
+
+	// Display context properties
+	uint16_t screen_width;
+	uint16_t screen_height;
+	uint8_t  screen_rotation  = display_context->rotation;
+
+
+	if((screen_rotation&0x1) == 0x01){
+		screen_height     = display_context->width; //change width to height
+		screen_width      = display_context->height; //change height to width
+	}else{
+		screen_width      = display_context->width;
+		screen_height     = display_context->height;
+	}
+
+
+	uint8_t reverse_x=0;
+	uint8_t reverse_y=0;
+
+
+	// 180 degree and 270 degree
+	if((screen_rotation&0x03)==0x02 || (screen_rotation&0x03)==0x03){
+		reverse_x=1;
+	}
+
+	// 0 degree and 270 degree
+	if((screen_rotation&0x03)==0x00 || (screen_rotation&0x03)==0x03){
+		reverse_y=1;
+	}
+
+
+	// Character bitmap info (shaped from the character header)
+	uint8_t bitmap_height = glyph->height;
+	uint8_t bitmap_width  = glyph->width;
+	int8_t  bitmap_top    = glyph->top;
+
+
+	cx +=glyph->left;
+
+	uint8_t mode=LFC_DRAW_SET;
+	if(print_form->config & LFC_INVERT){
+		mode=LFC_DRAW_INVERT;
+		if(punch!=NULL && _LFC_Punch_Box(punch, cx, cy - (bitmap_height - bitmap_top), bitmap_width, bitmap_height)){
+			mode=LFC_DRAW_PUNCH;
+		}
+	}
+
+	int16_t min_x,max_x;
+	int16_t min_y,max_y;
+
+
+	if(reverse_x){
+		int16_t rx = screen_width  - cx;
+		min_x=rx-bitmap_width;
+		max_x=rx;
+	}else{
+		min_x=cx;
+		max_x=cx+bitmap_width;
+	}
+
+	int16_t chr_top=bitmap_height-bitmap_top;
+	if(reverse_y){
+		int16_t ry = screen_height - cy + chr_top;
+		min_y=ry - bitmap_height;
+		max_y=ry;
+	}else{
+		int16_t ry = cy - chr_top;
+		min_y=ry;
+		max_y=ry + bitmap_height;
+	}
+
+	LFC_CHR_BITMAP chr;
+	chr.bitmap   = NULL;                     // Read when the glyph is visible
+	chr.width    = bitmap_width;
+	chr.row_bits = bitmap_width;
+	chr.height   = bitmap_height;
+	chr.min_x    = min_x;
+	chr.max_x    = max_x;
+	chr.min_y    = min_y;
+	chr.max_y    = max_y;
+	chr.rotation = screen_rotation;
+	chr.mode     = mode;
+
+
+	// Character box in display coordinates (90 and 270 degrees change x and y axis)
+	int16_t px_min,px_max;
+	int16_t py_min,py_max;
+
+	if(screen_rotation&0x01){
+		px_min=min_y;
+		px_max=max_y;
+		py_min=min_x;
+		py_max=max_x;
+	}else{
+		px_min=min_x;
+		px_max=max_x;
+		py_min=min_y;
+		py_max=max_y;
+	}
+
+	// Clip character box to the visible window, the kernels read only the
+	// visible part of the bitmap
+	int16_t win_min_x,win_max_x;
+	int16_t win_min_y,win_max_y;
+
+	_LFC_Clip_Window(display_context, &win_min_x, &win_max_x, &win_min_y, &win_max_y);
+
+	if(px_min < win_min_x){
+		px_min = win_min_x;
+	}
+	if(px_max > win_max_x){
+		px_max = win_max_x;
+	}
+	if(py_min < win_min_y){
+		py_min = win_min_y;
+	}
+	if(py_max > win_max_y){
+		py_max = win_max_y;
+	}
+
+	// Render visible part with the kernel of the display rotation
+	if(px_min < px_max && py_min < py_max){
+
+		_LFC_Mark_Dirty(display_context, px_min, px_max, py_min, py_max);
+
+		// Use cached bitmap if the glyph fits in the glyph cache
+		if(print_form->glyph_cache!=NULL){
+			LFC_GLYPH_CACHE *cache = print_form->glyph_cache;
+			LFC_CACHE_SLOT  *slot  = _LFC_Cache_Glyph(cache, font_handle, glyph);
+			if(slot!=NULL){
+				chr.bitmap   = cache->bitmaps + (uint16_t)(slot - cache->slots) * cache->bitmap_size;
+				chr.row_bits = slot->stride * 8;
+			}
+		}
+
+		// Bitmap follows the 5 byte character header
+		if(chr.bitmap==NULL){
+			chr.bitmap = _LFC_Glyph_Bitmap(font_handle, glyph->offset);
+			if(chr.bitmap==NULL){
+				return;
+			}
+		}
+
+		if(display_context->frame_buffer!=NULL){
+			_lfc_page_kernels[screen_rotation & 0x03](display_context, &chr, px_min, px_max, py_min, py_max);
+		}else{
+			_lfc_span_kernels[screen_rotation & 0x03](display_context, &chr, px_min, px_max, py_min, py_max);
+		}
+	}
+
+}
+
+
+
+/**
+ * @brief Calculates the box drawn for a missing character
+ *
+ * @param glyph: Missing glyph
+ * @param x: Caret X coordinate of the glyph
+ * @param y: Baseline Y coordinate
+ * @param rect: Output rectangle (width 0: glyph too small, nothing is drawn)
+ *
+ * @return: 1 if the box is drawn, 0 otherwise
+ */
+
+static uint8_t _LFC_Missing_Rect(const LFC_GLYPH * glyph, int16_t x, int16_t y, LFC_RECT * rect) {
+
+	rect->x = x + 2;
+	rect->y = y;
+
+	if(glyph->width<=5){
+		rect->width  = 0;
+		rect->height = 0;
+		return 0;
+	}
+
+	rect->width  = glyph->width-4;
+	rect->height = glyph->width;
+	return 1;
+}
+
+
+
+/**
+ * @brief Renders a shaped glyph and moves the caret
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param glyph: Shaped glyph (bitmap, missing character or newline)
+ * @param x : Line start X coordinate (caret returns here after a newline)
+ * @param px: Caret X coordinate, advanced by the glyph
+ * @param py: Caret Y coordinate, moved down by a newline
+ * @param punch: Free part of the filled bounding box (inverted text), NULL: background is not filled
+ */
+
+static void _LFC_Draw_Shaped(PRINT_FORM * print_form, const LFC_FONT * font_handle, const LFC_GLYPH * glyph, int16_t x, int16_t * px, int16_t * py, LFC_RECT * punch) {
+
+	LFC_RECT rect;
+
+	switch(glyph->type){
+
+	case LFC_GLYPH_NEWLINE:
+		*px = x;                  // Return to left edge
+		*py -= glyph->height + 1; // Move to next line
+
+		// Glyphs of the next lines may reach into this line, draw them inverted
+		if(punch!=NULL){
+			punch->width = 0;
+		}
+		break;
+
+	case LFC_GLYPH_MISSING:
+		// Unknown character; we use a rectangle instead of it.
+		if(_LFC_Missing_Rect(glyph, *px, *py, &rect)){
+			LFC_Draw_Rect(print_form->display_context,&rect,LFC_LINE,0);
+		}
+		*px += glyph->advance; // Calculate space
+		break;
+
+	default:
+		_LFC_Draw_Glyph(print_form, font_handle, glyph, *px, *py, punch);
+		*px += glyph->advance;
+		break;
+	}
+}
+
+
+
+
+static int16_t _LFC_Print(PRINT_FORM * print_form, const LFC_FONT * font_handle, LFC_TEXT * text, int16_t x, int16_t y, LFC_RECT * punch) {
+
+	// Check validate
+	if(print_form==NULL || text==NULL){
+		return 1;
+	}
+
+	// Check validate
+	if(print_form->display_context==NULL){
+		return 1;
+	}
+
+	if(font_handle==NULL){
+		return 0; // Invalid font
+	}
+
+	int16_t px, py;
+	px = x;
+	py = y;
+
+	LFC_GLYPH glyph;
+	uint8_t   next;
+
+	// Process text character by character
+	while ((next = _LFC_Next_Glyph(print_form, font_handle, text, &glyph)) == LFC_TEXT_GLYPH) {
+
+		// Render character and advance caret
+		_LFC_Draw_Shaped(print_form, font_handle, &glyph, x, &px, &py, punch);
+	}
+
+	if (next == LFC_TEXT_ERROR) {
+		return 0; // Conversion error
+	}
+
+	return px; // Return next X position
+}
+
+
+
+// String measurement state, glyphs are added one by one
+typedef struct{
+	int16_t py;         // Baseline of the current line
+	int16_t min_y;      // Bounding box bottom
+	int16_t max_y;      // Bounding box top
+	int16_t line_width; // Width of the current line
+	int16_t max_width;  // Width of the widest finished line
+}LFC_MEASURE;
+
+
+static void _LFC_Measure_Start(LFC_MEASURE * measure, int16_t y) {
+	measure->py         = y;
+	measure->min_y      = 32000; // Initialize with big value
+	measure->max_y      = y;
+	measure->line_width = 0;
+	measure->max_width  = 0;
+}
+
+
+static void _LFC_Measure_Glyph(const PRINT_FORM * print_form, LFC_MEASURE * measure, const LFC_GLYPH * glyph) {
+
+	switch(glyph->type){
+
+	case LFC_GLYPH_NEWLINE:
+		measure->py -= glyph->height + 1; // Move to next line
+
+		// Remove last space in the end of line
+		if(print_form->config & (LFC_SPACING)){
+			measure->line_width -= print_form->spacing;
+		}
+
+		if(measure->max_width < measure->line_width){
+			measure->max_width = measure->line_width;
+		}
+		measure->line_width = 0;
+		break;
+
+	case LFC_GLYPH_MISSING:
+		measure->line_width += glyph->advance;
+
+		if((glyph->height + measure->py) > measure->max_y){
+			measure->max_y = glyph->height + measure->py;
+		}
+		if(measure->min_y > measure->py){
+			measure->min_y = measure->py;
+		}
+		break;
+
+	default:
+		measure->line_width += glyph->advance;
+
+		// Calculate top Y coordinate of character
+		int16_t base_line = measure->py - (glyph->height - glyph->top);
+
+		// Update bounding box
+		if (measure->min_y > base_line) {
+			measure->min_y = base_line;
+		}
+
+		if (measure->max_y < (base_line + glyph->height)) {
+			measure->max_y = base_line + glyph->height;
+		}
+		break;
+	}
+}
+
+
+static void _LFC_Measure_End(const PRINT_FORM * print_form, const LFC_MEASURE * measure, LFC_RECT * rect) {
+
+	uint8_t padding = print_form->padding;
+	int16_t max_width = measure->max_width;
+
+	if(max_width < measure->line_width){
+		max_width = measure->line_width;
+	}
+
+	// Set final rectangle dimensions
+	rect->width = max_width;
+	rect->y = measure->min_y;
+	rect->height = measure->max_y - measure->min_y;
+
+
+	// Apply padding
+	rect->width  += (2 * padding);
+	rect->height += (2 * padding);
+
+	rect->x -= padding;
+	rect->y -= padding;
+}
+
+
+
+/**
+ * @brief Moves a measured bounding box to the anchor point of the print form
+ *
+ * @param config: Print form configuration (anchor bits)
+ * @param rect: Bounding box, padding included
+ * @param x: Anchor X coordinate
+ * @param y: Anchor Y coordinate
+ *
+ * Left and baseline anchors keep the measured position.
+ */
+
+static void _LFC_Anchor_Rect(uint8_t config, LFC_RECT * rect, int16_t x, int16_t y) {
+
+	switch(config & LFC_ANCHOR_H_MASK){
+	case LFC_ANCHOR_CENTER:
+		rect->x = x - rect->width/2;
+		break;
+	case LFC_ANCHOR_RIGHT:
+		rect->x = x - rect->width;
+		break;
+	}
+
+	switch(config & LFC_ANCHOR_V_MASK){
+	case LFC_ANCHOR_TOP:
+		rect->y = y - rect->height;
+		break;
+	case LFC_ANCHOR_BOTTOM:
+		rect->y = y;
+		break;
+	}
+}
+
+
+
+/**
+ * @brief Calculates the bounding rectangle for a text with a resolved font
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param text: Input text
+ * @param x  : Starting X coordinate
+ * @param y  : Starting Y coordinate
+ * @param rect: Output rectangle structure
+ *
+ * @return: 0 on success, 1 on error
+ */
+
+static uint8_t _LFC_Str_Rect(PRINT_FORM * print_form, const LFC_FONT * font_handle, LFC_TEXT * text, int16_t x, int16_t y, LFC_RECT *rect) {
+
+	if(print_form==NULL || text==NULL || rect==NULL){
+		return 1;
+	}
+
+	if(print_form->display_context==NULL || font_handle==NULL){
+		return 1;
+	}
+
+	LFC_GLYPH   glyph;
+	LFC_MEASURE measure;
+	uint8_t     next;
+
+	// Initialize rectangle
+	rect->height = 0;
+	rect->width = 0;
+	rect->x = x;
+	rect->y = y;
+
+	_LFC_Measure_Start(&measure, y);
+
+	// Calculate dimensions for each character
+	while ((next = _LFC_Next_Glyph(print_form, font_handle, text, &glyph)) == LFC_TEXT_GLYPH) {
+		_LFC_Measure_Glyph(print_form, &measure, &glyph);
+	}
+
+	if (next == LFC_TEXT_ERROR) {
+		return 0;
+	}
+
+	_LFC_Measure_End(print_form, &measure, rect);
+	_LFC_Anchor_Rect(print_form->config, rect, x, y);
+
+	return 0;
+}
+
+
+
+/*
+ * @brief Calculates the bounding rectangle for a string without rendering it
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-8 encoded input string
+ * @param x  : Starting X coordinate
+ * @param y  : Starting Y coordinate
+ * @param rect: Output rectangle structure
+ *
+ * @return: 0 on success, 1 on error
+ *
+ * This function calculates the exact dimensions that a string would occupy
+ * if rendered, useful for text layout, centering, and background drawing.
+ * The padding of the print form is added around the text.
+ */
+uint8_t LFC_Str_Rect(PRINT_FORM * print_form,const uint8_t * str, int16_t x, int16_t y,LFC_RECT *rect) {
+
+	if(print_form==NULL || str==NULL){
+		return 1;
+	}
+
+	LFC_TEXT text;
+	_LFC_Text_Utf8(&text, str);
+
+	LFC_FONT raw_font;
+	return _LFC_Str_Rect(print_form, _LFC_Form_Font(print_form, &raw_font), &text, x, y, rect);
+}
+
+
+
+/*
+ * @brief Calculates the bounding rectangle for length-bounded UTF-8 text without rendering it
+ *
+ * @param print_form: Font properties
+ * @param str   : UTF-8 encoded input text
+ * @param length: Bytes in the text (the text also ends at a zero byte)
+ * @param x     : Starting X coordinate
+ * @param y     : Starting Y coordinate
+ * @param rect  : Output rectangle structure
+ *
+ * @return: 0 on success, 1 on error
+ */
+uint8_t LFC_Str_Rect_N(PRINT_FORM * print_form, const uint8_t * str, uint16_t length, int16_t x, int16_t y, LFC_RECT *rect) {
+
+	if(print_form==NULL || str==NULL){
+		return 1;
+	}
+
+	LFC_TEXT text;
+	_LFC_Text_Utf8_N(&text, str, length);
+
+	LFC_FONT raw_font;
+	return _LFC_Str_Rect(print_form, _LFC_Form_Font(print_form, &raw_font), &text, x, y, rect);
+}
+
+
+
+/*
+ * @brief Initialize a display context
+ *
+ * @param display_context: Display properties
+ * @param width: Screen width before rotation
+ * @param height: Screen height before rotation
+ * @param rotation: Display rotation 0-3
+ * @param set_pixel_func: Set pixel function (defined in the display driver)
+ *
+ * @return: 0:Success, 1:Error NULL pointer
+ *
+ * The whole structure is cleared first, so the optional fields are NULL
+ * even if the caller does not know them.
+ */
+
+uint8_t LFC_Display_Init(DISPLAY_CONTEXT * display_context, uint16_t width, uint16_t height, uint8_t rotation, CB_Set_Pixel set_pixel_func){
+
+	// Validate
+	if(display_context==NULL){
+		return 1;
+	}
+
+	memset(display_context, 0, sizeof(DISPLAY_CONTEXT));
+
+	display_context->width          = width;
+	display_context->height         = height;
+	display_context->rotation       = rotation;
+	display_context->set_pixel_func = set_pixel_func;
+
+	return 0;
+}
+
+
+
+/*
+ * @brief Draws a rectangle on the display with optional filling
+ * @param rect: Rectangle structure defining position and size
+ * @param fill: 1 to fill rectangle, 0 for outline only
+ * @param invert: Invert drawing colors
+ * @return: 0 if successful, 1 if rectangle is completely off-screen (or outside the clip rectangle)
+ *
+ * This function handles rectangle drawing with proper clipping to screen
+ * boundaries and supports both filled and outline rendering modes.
+ */
+
+static uint8_t _LFC_Draw_Rect(DISPLAY_CONTEXT * display_context, LFC_RECT * rect, uint8_t fill, uint8_t invert) {
+
+	if(rect==NULL || display_context==NULL){
+		return 1;
+	}
+
+
+	if(display_context->set_pixel_func==NULL && display_context->frame_buffer==NULL){
+		return 1;
+	}
+
+	// Visible window: screen or clip rectangle
+	int16_t win_min_x,win_max_x;
+	int16_t win_min_y,win_max_y;
+
+	_LFC_Clip_Window(display_context, &win_min_x, &win_max_x, &win_min_y, &win_max_y);
+
+
+	int16_t y;
+	int16_t max_x, min_x;
+	int16_t max_y, min_y;
+
+	uint8_t left_line   = 1;
+	uint8_t right_line  = 1;
+	uint8_t top_line    = 1;
+	uint8_t bottom_line = 1;
+
+
+	// Calculate rectangle boundaries
+	min_x=rect->x;
+	max_x=rect->x+rect->width;
+
+	min_y=rect->y;
+	max_y=rect->y+rect->height;
+
+
+	//Check if rectangle is completely outside window horizontally
+	if ((max_x <= win_min_x) || (min_x >= win_max_x)) {
+		return 1;
+	}
+
+	//Check if rectangle is completely outside window vertically
+	if ((max_y <= win_min_y) || (min_y >= win_max_y)) {
+		return 1;
+	}
+
+
+	// Clip rectangle to window boundaries
+	if(max_x > win_max_x){
+		max_x=win_max_x;
+		right_line = 0;
+	}
+	if(min_x < win_min_x){
+		min_x=win_min_x;
+		left_line = 0;
+	}
+
+
+	if(max_y > win_max_y){
+		max_y=win_max_y;
+		top_line = 0;
+	}
+	if(min_y < win_min_y){
+		min_y=win_min_y;
+		bottom_line = 0;
+	}
+
+
+	// A zero width or height outline still writes the lines at max-1 (one
+	// column or row before the rectangle), mark the pixels that are written
+	if(fill==LFC_FILL){
+		_LFC_Mark_Dirty(display_context, min_x, max_x, min_y, max_y);
+	}else{
+		_LFC_Mark_Dirty(display_context,
+				(max_x > min_x) ? min_x : max_x - 1, (max_x > min_x) ? max_x : min_x + 1,
+				(max_y > min_y) ? min_y : max_y - 1, (max_y > min_y) ? max_y : min_y + 1);
+	}
+
+	// Invert pixel
+	invert=invert?0:1;
+
+	// Fill entire rectangle
+	if (fill==LFC_FILL) {
+		if(display_context->frame_buffer!=NULL){
+			_LFC_Fill_Page_Rect(display_context, min_x, max_x, min_y, max_y, invert);
+		}else{
+			for (y = min_y; y <max_y; y++) {
+				_LFC_Set_Span(display_context, min_x, y, max_x - min_x, invert);
+			}
+		}
+	}
+
+	// Draw rectangle outline only
+	else {
+		// Draw left and right vertical lines
+		if (left_line) {
+			for (y = min_y; y < max_y; y++) {
+				_LFC_Set_Span(display_context, min_x, y, 1, invert);
+			}
+		}
+		if (right_line) {
+			for (y = min_y; y < max_y; y++) {
+				_LFC_Set_Span(display_context, max_x-1, y, 1, invert);
+			}
+		}
+
+		// Draw top and bottom horizontal lines
+		if (bottom_line) {
+			_LFC_Set_Span(display_context, min_x, min_y, max_x - min_x, invert);
+		}
+		if (top_line) {
+			_LFC_Set_Span(display_context, min_x, max_y-1, max_x - min_x, invert);
+		}
+	}
+
+	return 0;
+}
+
+
+
+
+
+uint8_t LFC_Draw_Rect(DISPLAY_CONTEXT * display_context, LFC_RECT * rect, uint8_t fill, uint8_t invert) {
+
+	LFC_RECT t_rect;
+
+	if(display_context==NULL || rect==NULL){
+		return 1;
+	}
+
+	// Rotate rectangle to display coordinates
+	_LFC_Rect_To_Display(display_context, rect, &t_rect);
+
+
+	return _LFC_Draw_Rect( display_context, &t_rect,  fill,  invert);
+
+}
+
+
+
+/*
+ * @brief Calculate string width without rendering
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-8 encoded input string
+ *
+ *
+ * @return: Width of the string in pixel
+ *
+ */
+uint16_t LFC_Str_Width(PRINT_FORM * print_form, const uint8_t *str) {
+
+	// Check null pointer
+	if(print_form==NULL || str==NULL){
+		return 0;
+	}
+
+	LFC_RECT rect;
+	LFC_Str_Rect(print_form,str,0,0,&rect);
+	return rect.width;
+
+}
+
+
+
+/*
+ * @brief Calculate length-bounded UTF-8 text width without rendering
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-8 encoded input text
+ * @param length: Bytes in the text (the text also ends at a zero byte)
+ *
+ * @return: Width of the text in pixel
+ *
+ */
+uint16_t LFC_Str_Width_N(PRINT_FORM * print_form, const uint8_t *str, uint16_t length) {
+
+	// Check null pointer
+	if(print_form==NULL || str==NULL){
+		return 0;
+	}
+
+	LFC_RECT rect;
+	rect.width = 0;
+	LFC_Str_Rect_N(print_form,str,length,0,0,&rect);
+	return rect.width;
+
+}
+
+
+/**
+ * @brief Calculates the width of the line starting at a shaped glyph
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param glyphs: Shaped glyphs from the line start
+ * @param count: Number of shaped glyphs
+ * @param rest: Text after the shaped glyphs, NULL: none
+ *
+ * @return: Line width without the spacing after the last glyph
+ *
+ * The line ends at a newline, the glyphs after the shaped ones are shaped
+ * from a copy of the rest text (only lines longer than the buffer).
+ */
+
+static int16_t _LFC_Line_Width(const PRINT_FORM * print_form, const LFC_FONT * font_handle, const LFC_GLYPH * glyphs, uint16_t count, const LFC_TEXT * rest) {
+
+	int16_t width = 0;
+	uint8_t ended = 0;
+
+	for(uint16_t i=0; i<count; i++){
+		if(glyphs[i].type == LFC_GLYPH_NEWLINE){
+			ended = 1;
+			break;
+		}
+		width += glyphs[i].advance;
+	}
+
+	if(!ended && rest!=NULL){
+		LFC_TEXT  text = *rest;
+		LFC_GLYPH glyph;
+
+		while(_LFC_Next_Glyph(print_form, font_handle, &text, &glyph) == LFC_TEXT_GLYPH && glyph.type != LFC_GLYPH_NEWLINE){
+			width += glyph.advance;
+		}
+	}
+
+	// Remove last space in the end of line
+	if(width!=0 && (print_form->config & LFC_SPACING)){
+		width -= print_form->spacing;
+	}
+
+	return width;
+}
+
+
+
+/**
+ * @brief Calculates the start X coordinate of an anchored line
+ *
+ * @param print_form: Font properties
+ * @param rect: Anchored bounding box
+ * @param x: Line start of left anchored text
+ * @param width: Line width
+ *
+ * @return: Line start X coordinate
+ */
+
+static int16_t _LFC_Line_X(const PRINT_FORM * print_form, const LFC_RECT * rect, int16_t x, int16_t width) {
+
+	switch(print_form->config & LFC_ANCHOR_H_MASK){
+	case LFC_ANCHOR_CENTER:
+		return rect->x + ((int16_t)rect->width - width)/2;
+	case LFC_ANCHOR_RIGHT:
+		return rect->x + (int16_t)rect->width - print_form->padding - width;
+	default:
+		return x;
+	}
+}
+
+
+
+/**
+ * @brief Renders measured shaped glyphs line by line
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param glyphs: Shaped glyphs
+ * @param count: Number of shaped glyphs
+ * @param rest: Text after the shaped glyphs (shaped while drawing), NULL: none
+ * @param rect: Anchored bounding box (line alignment)
+ * @param x  : Line start of left anchored text
+ * @param y  : First baseline
+ * @param punch: Free part of the filled bounding box (inverted text), NULL: background is not filled
+ *
+ * @return: Next X coordinate, 0 on conversion error
+ */
+
+static int16_t _LFC_Draw_Lines(PRINT_FORM * print_form, const LFC_FONT * font_handle, const LFC_GLYPH * glyphs, uint16_t count, LFC_TEXT * rest, const LFC_RECT * rect, int16_t x, int16_t y, LFC_RECT * punch) {
+
+	uint8_t aligned = (print_form->config & LFC_ANCHOR_H_MASK) != LFC_ANCHOR_LEFT;
+
+	if(aligned){
+		x = _LFC_Line_X(print_form, rect, x, _LFC_Line_Width(print_form, font_handle, glyphs, count, rest));
+	}
+
+	int16_t px = x;
+	int16_t py = y;
+
+	for(uint16_t i=0; i<count; i++){
+
+		// Start of the next line
+		if(aligned && glyphs[i].type == LFC_GLYPH_NEWLINE){
+			x = _LFC_Line_X(print_form, rect, x, _LFC_Line_Width(print_form, font_handle, &glyphs[i+1], count-i-1, rest));
+		}
+		_LFC_Draw_Shaped(print_form, font_handle, &glyphs[i], x, &px, &py, punch);
+	}
+
+	if(rest==NULL){
+		return px;
+	}
+
+	// Characters after the shaped glyphs (or the conversion error)
+	LFC_GLYPH glyph;
+	uint8_t   next;
+
+	while ((next = _LFC_Next_Glyph(print_form, font_handle, rest, &glyph)) == LFC_TEXT_GLYPH) {
+
+		if(aligned && glyph.type == LFC_GLYPH_NEWLINE){
+			x = _LFC_Line_X(print_form, rect, x, _LFC_Line_Width(print_form, font_handle, NULL, 0, rest));
+		}
+		_LFC_Draw_Shaped(print_form, font_handle, &glyph, x, &px, &py, punch);
+	}
+
+	if (next == LFC_TEXT_ERROR) {
+		return 0; // Conversion error
+	}
+
+	return px;
+}
+
+
+
+/**
+ * @brief Renders a text that is measured first (bounding box or anchor)
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param text: Input text
+ * @param x  : Starting X coordinate (padding added)
+ * @param y  : Starting Y coordinate (padding added)
+ *
+ * @return: Next X coordinate, 0 on conversion error
+ *
+ * The box must be drawn before the glyphs (inverted text punches the glyphs
+ * out of the filled box) and the anchored origin is only known after the
+ * whole text is measured. The first LFC_PRINT_CHUNK glyphs are shaped into a
+ * stack buffer while measuring and drawn from it, so short strings are
+ * decoded and looked up only once. The rest of a longer string is only
+ * measured in the first pass and shaped again while drawing.
+ */
+
+static int16_t _LFC_Print_Measured(PRINT_FORM * print_form, const LFC_FONT * font_handle, LFC_TEXT * text, int16_t x, int16_t y) {
+
+	LFC_GLYPH   glyphs[LFC_PRINT_CHUNK];
+	LFC_GLYPH   glyph;
+	LFC_MEASURE measure;
+	LFC_RECT    rect;
+
+	LFC_TEXT rest = *text; // First character after the buffered glyphs
+	uint16_t count = 0;
+	uint8_t  next;
+
+	// Shape and measure, keep the glyphs of the first chunk
+	_LFC_Measure_Start(&measure, y);
+
+	while (1) {
+
+		LFC_GLYPH *g = (count < LFC_PRINT_CHUNK) ? &glyphs[count] : &glyph;
+
+		next = _LFC_Next_Glyph(print_form, font_handle, text, g);
+		if (next != LFC_TEXT_GLYPH) {
+			break; // End of text, or conversion error: the box is left empty
+		}
+
+		_LFC_Measure_Glyph(print_form, &measure, g);
+
+		if(count < LFC_PRINT_CHUNK){
+			count++;
+			rest = *text;
+		}
+	}
+
+	rect.x = x;
+	rect.y = y;
+	rect.width  = 0;
+	rect.height = 0;
+
+	// Move the measured box and the baseline to the anchor point
+	if(next == LFC_TEXT_END){
+		_LFC_Measure_End(print_form, &measure, &rect);
+
+		int16_t measured_y = rect.y;
+		_LFC_Anchor_Rect(print_form->config, &rect, x - print_form->padding, y - print_form->padding);
+		y += rect.y - measured_y;
+	}
+
+	uint8_t fill=0;
+	if(print_form->config & LFC_BOUNDING_BOX){
+		if(print_form->config & LFC_INVERT){
+			fill=1;
+		}
+		LFC_Draw_Rect(print_form->display_context,&rect, fill,0);
+	}
+
+	// Inverted text: the box is filled already, only punch out the glyph pixels
+	// (after a conversion error the box is empty, the glyphs are drawn inverted)
+	LFC_RECT punch = rect;
+
+	return _LFC_Draw_Lines(print_form, font_handle, glyphs, count, &rest, &rect, x, y, fill ? &punch : NULL);
+}
+
+
+
+/**
+ * @brief Renders a text with the print form options (padding, bounding box, anchor)
+ *
+ * @param print_form: Font properties
+ * @param text: Input text
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the text
+ */
+
+static int16_t _LFC_Print_Text(PRINT_FORM * print_form, LFC_TEXT * text, int16_t pos_x, int16_t pos_y) {
+
+	if(print_form->display_context==NULL){
+		return 0;
+	}
+
+	// Resolve font once for measuring and rendering
+	LFC_FONT raw_font;
+	const LFC_FONT *font_handle = _LFC_Form_Font(print_form, &raw_font);
+	if(font_handle==NULL){
+		return 0;
+	}
+
+	pos_x+=print_form->padding;
+	pos_y+=print_form->padding;
+
+	// If set boundary box draw it and show string
+	if(print_form->config & LFC_BOUNDING_BOX){
+		return _LFC_Print_Measured(print_form,font_handle,text, pos_x, pos_y)+2*print_form->padding;
+	}
+
+	// Anchored string is measured before drawing
+	if(print_form->config & (LFC_ANCHOR_H_MASK | LFC_ANCHOR_V_MASK)){
+		return _LFC_Print_Measured(print_form,font_handle,text, pos_x, pos_y);
+	}
+
+	// Show string Without boundary box
+	return _LFC_Print(print_form,font_handle,text, pos_x, pos_y, NULL);
+}
+
+
+
+/*
+ * @brief Renders UTF-8 encoded string to display
+ *
+ * @param print_form: Font properties
+ * @param str       : UTF-8 encoded input string
+ * @param x         : Starting X coordinate
+ *
+ * @return          : Final X coordinate after rendering complete string ( x + string width)
+ *
+ * This is the main string rendering function that processes UTF-8 strings,
+ * handles special characters (space, newline), converts to UTF-32,
+ * looks up characters in font, and renders them sequentially.
+ */
+
+int16_t LFC_Print(PRINT_FORM * print_form, const uint8_t * str, int16_t pos_x, int16_t pos_y){
+
+	// Check null pointer
+	if(print_form==NULL || str==NULL){
+		return 0;
+	}
+
+	LFC_TEXT text;
+	_LFC_Text_Utf8(&text, str);
+
+	return _LFC_Print_Text(print_form, &text, pos_x, pos_y);
+}
+
+
+
+/*
+ * @brief Renders length-bounded UTF-8 text to display (no terminating zero needed)
+ *
+ * @param print_form: Font properties
+ * @param str       : UTF-8 encoded input text
+ * @param length    : Bytes in the text (the text also ends at a zero byte)
+ * @param pos_x     : Starting X coordinate
+ * @param pos_y     : Starting Y coordinate
+ *
+ * @return          : Final X coordinate after rendering the text
+ *
+ * Renders slices of larger buffers (UART lines, ring buffer segments) in
+ * place. No byte after str[length-1] is read, a multi-byte sequence cut by
+ * the end of the slice is a conversion error as an invalid sequence is.
+ */
+
+int16_t LFC_Print_N(PRINT_FORM * print_form, const uint8_t * str, uint16_t length, int16_t pos_x, int16_t pos_y){
+
+	// Check null pointer
+	if(print_form==NULL || str==NULL){
+		return 0;
+	}
+
+	LFC_TEXT text;
+	_LFC_Text_Utf8_N(&text, str, length);
+
+	return _LFC_Print_Text(print_form, &text, pos_x, pos_y);
+}
+
+
+
+
+/*
+ * @brief Converts a UTF-32 character code to UTF-8 encoding
+ *
+ * @param utf32_c: UTF-32 character code to be converted
+ * @param utf8_s: Pointer to buffer where UTF-8 encoded result will be stored (7 bytes)
+ * @return: Number of bytes written to the output buffer (1-6 bytes)
+ * @note: Handles Unicode character conversion from 32-bit format to variable-length UTF-8 encoding
+ *        The output buffer must have at least 7 bytes of available space
+ */
+uint8_t LFC_Utf32_To_Utf8(uint32_t utf32_c, uint8_t* utf8_s) {
+	uint8_t us8_len;
+	uint8_t mask = 0xFF;
+
+	// Check null pointer
+	if(utf8_s==NULL){
+		return 0;
+	}
+
+	// Zero-initialize buffer to ensure null-termination and prevent data leakage for any sequence length.
+    for (uint8_t i = 0; i < 7; i++) {
+        utf8_s[i] = 0;
+    }
+
+    us8_len = 0;
+
+    if (utf32_c < 0x80) {
+        utf8_s[us8_len++] = utf32_c;
+    }
+    else if (utf32_c < 0x800) {
+        mask = mask << 6;
+        utf8_s[us8_len++] = (((utf32_c) >> 6) & 0x1F) | mask;
+        utf8_s[us8_len++] = (utf32_c & 0x3F) | 0x80;
+    }
+    else if (utf32_c < 0x10000) {
+        mask = mask << 5;
+        utf8_s[us8_len++] = (((utf32_c) >> 12) & 0x0F) | mask;
+        utf8_s[us8_len++] = (((utf32_c) >>  6) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (utf32_c & 0x3F) | 0x80;
+    }
+    else if (utf32_c < 0x200000) {
+        mask = mask << 4;
+        utf8_s[us8_len++] = (((utf32_c) >> 18) & 0x07) | mask;
+        utf8_s[us8_len++] = (((utf32_c) >> 12) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (((utf32_c) >>  6) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (utf32_c & 0x3F) | 0x80;
+    }
+    else if(utf32_c < 0x4000000) {
+        mask = mask << 3;
+        utf8_s[us8_len++] = (((utf32_c) >> 24) & 0x03) | mask;
+        utf8_s[us8_len++] = (((utf32_c) >> 18) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (((utf32_c) >> 12) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (((utf32_c) >>  6) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (utf32_c& 0x3F) | 0x80;
+    }
+    else if (utf32_c < 0x80000000) {
+        mask = mask << 2;
+        utf8_s[us8_len++] = (((utf32_c) >> 30) & 0x01) | mask;
+        utf8_s[us8_len++] = (((utf32_c) >> 24) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (((utf32_c) >> 18) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (((utf32_c) >> 12) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (((utf32_c) >>  6) & 0x3F) | 0x80;
+        utf8_s[us8_len++] = (utf32_c & 0x3F) | 0x80;
+    }
+
+    return us8_len;
+}
+
+
+
+/*
+ * @brief Initialize a print form
+ *
+ * @param print_form: Font properties
+ * @param font: Font array (C8, C9 or wide format)
+ * @param display_context: Display properties
+ *
+ * @return: 0:Success, 1:Error NULL pointer
+ *
+ * The whole structure is cleared first, so the optional fields are NULL
+ * even if the caller does not know them.
+ */
+
+uint8_t LFC_Form_Init(PRINT_FORM * print_form, const uint8_t * font, DISPLAY_CONTEXT * display_context){
+
+	// Validate
+	if(print_form==NULL){
+		return 1;
+	}
+
+	memset(print_form, 0, sizeof(PRINT_FORM));
+
+	print_form->font            = font;
+	print_form->config          = LFC_DEFAULT_CONFIG;
+	print_form->display_context = display_context;
+	print_form->tabular         = LFC_PROPORTIONAL;
+
+	return 0;
+}
+
+
+
+/*
+ * @brief Copy print form
+ *
+ * @param dest: Source print form structure
+ * @param src : Destination print form structure
+ *
+ * @return: 0:Success, 1:Error NULL pointer
+ *
+ */
+
+uint8_t LFC_Copy_Print_Form(PRINT_FORM * dest,const PRINT_FORM * src){
+	// Validate
+	if(dest==NULL || src==NULL){
+		return 1;
+	}
+
+	// Copy all fields, optional fields added later are copied too
+	*dest = *src;
+
+	return 0;
+}
+
+
+
+/**
+ * @brief C9 page index validation
+ *
+ * @param font_handle: Font handle with the parsed header (font array or font source)
+ * @param index_offset: Page index offset from the font start
+ * @param index_start: First byte the page index may use (end of the offset table)
+ * @param index_end: Output, first byte after the page index
+ *
+ * @return: 0: Success, 5: Error page index
+ *
+ * The page index must list the characters in code point order (the first
+ * indexed code point is character 0, the next one character 1, ...) and
+ * must hold all of them. Ranges are optional with a page index, each of
+ * them must resolve to the same characters as the page index.
+ */
+
+static uint8_t _LFC_Check_C9_Pages(const LFC_FONT * font_handle, LFC_OFFSET index_offset, uint32_t index_start, uint32_t * index_end){
+
+	if(index_offset<index_start){
+		return 5; // Error page index
+	}
+
+	const uint8_t *index = _LFC_Font_Bytes(font_handle, index_offset, LFC_C9_PAGE_HEADER_SIZE);
+
+	uint16_t chr_count   = font_handle->character_count;
+	uint16_t first_page  = index[0] | ((uint16_t)index[1] << 8);
+	uint16_t page_count  = index[2] | ((uint16_t)index[3] << 8);
+	uint16_t block_count = index[4] | ((uint16_t)index[5] << 8);
+
+	if((uint32_t)first_page + page_count > (0x10FFFF >> 8) + 1){
+		return 5; // Pages beyond the last code point
+	}
+
+	uint16_t indexed = 0; // Next expected character index
+
+	for(uint16_t p=0;p<page_count;p++){
+		const uint8_t *table = _LFC_Font_Bytes(font_handle, font_handle->page_table + (uint32_t)p*2, 2);
+		uint16_t block = table[0] | ((uint16_t)table[1] << 8);
+
+		if(block==LFC_C9_NO_PAGE){
+			continue;
+		}
+		if(block>=block_count){
+			return 5; // Block out of the page index
+		}
+
+		uint32_t page_code = ((uint32_t)first_page + p) << 8;
+
+		for(uint16_t c=0;c<256;c++){
+			uint16_t entry = _LFC_Page_Entry(font_handle, page_code + c);
+			if(entry==LFC_NO_ENTRY){
+				continue;
+			}
+			if(entry!=indexed || indexed==chr_count){
+				return 5; // Characters out of code point order
+			}
+			indexed++;
+		}
+	}
+
+	if(indexed!=chr_count){
+		return 5; // Characters missing from the page index
+	}
+
+	for(uint16_t r=0;r<font_handle->range_count;r++){
+		const uint8_t *range = _LFC_Font_Bytes(font_handle, font_handle->cmap + (uint32_t)r * LFC_C9_RANGE_SIZE, LFC_C9_RANGE_SIZE);
+
+		uint32_t first  = range[0] | ((uint32_t)range[1] << 8) | ((uint32_t)range[2] << 16) | ((uint32_t)range[3] << 24);
+		uint16_t length = range[4] | ((uint16_t)range[5] << 8);
+		uint16_t entry  = range[6] | ((uint16_t)range[7] << 8);
+
+		for(uint16_t k=0;k<length;k++){
+			if(_LFC_Page_Entry(font_handle, first + k)!=entry + k){
+				return 5; // Range differs from the page index
+			}
+		}
+	}
+
+	*index_end = font_handle->glyphs;
+
+	return 0; // Success
+}
+
+
+
+/**
+ * @brief C9 font validation (range character map)
+ *
+ * @param font_handle: Font handle with the parsed header (C9 or wide C9)
+ * @param index_offset: Page index offset of the header, 0: no page index
+ *
+ * @return: Same codes as LFC_Check_Font
+ *
+ * Ranges must be sorted and must not overlap, each range must stay inside
+ * the offset table, offsets must be ascending from the character data.
+ * The optional page index sits between the offset table and the
+ * character data.
+ */
+
+static uint8_t _LFC_Check_C9_Font(const LFC_FONT * font_handle, LFC_OFFSET index_offset){
+
+	uint16_t chr_count   = font_handle->character_count;
+	uint16_t range_count = font_handle->range_count;
+
+	uint32_t next_code = 0; // First code point allowed for the next range
+
+	for(uint16_t r=0;r<range_count;r++){
+		const uint8_t *range = _LFC_Font_Bytes(font_handle, font_handle->cmap + (uint32_t)r * LFC_C9_RANGE_SIZE, LFC_C9_RANGE_SIZE);
+
+		uint32_t first  = range[0] | ((uint32_t)range[1] << 8) | ((uint32_t)range[2] << 16) | ((uint32_t)range[3] << 24);
+		uint16_t length = range[4] | ((uint16_t)range[5] << 8);
+		uint16_t entry  = range[6] | ((uint16_t)range[7] << 8);
+
+		if(length==0 || (r && first<next_code) || (uint32_t)entry+length>chr_count){
+			return 3; // Error structure length
+		}
+
+		next_code = first + length;
+	}
+
+	// Start of the character data, computed in 32 bits (16-bit offsets of a broken header can wrap)
+	uint32_t last_offset = font_handle->cmap + (uint32_t)range_count * LFC_C9_RANGE_SIZE + (uint32_t)chr_count * font_handle->offset_size;
+	LFC_OFFSET chr_offset;
+
+	if(index_offset){
+		uint8_t result = _LFC_Check_C9_Pages(font_handle, index_offset, last_offset, &last_offset);
+		if(result){
+			return result;
+		}
+	}
+
+	for(uint16_t i=0;i<chr_count;i++){
+		chr_offset = _LFC_Chr_Offset(font_handle, i);
+
+		if(last_offset>chr_offset){
+			return 4; // Offset address error
+		}
+
+		last_offset=chr_offset;
+	}
+
+	return 0; // Success
+}
+
+
+
+/**
+ * @brief Font validation through a font handle
+ *
+ * @param font_handle: Font handle with data or source set
+ *
+ * @return: Same codes as LFC_Check_Font
+ *
+ * The font is read with _LFC_Font_Bytes, so fonts in memory and fonts in
+ * a font source are checked by the same code. The header is parsed into
+ * the handle (no direct index, number or tabular tables).
+ */
+
+static uint8_t _LFC_Check_Handle(LFC_FONT * font_handle){
+
+	const uint8_t *header = _LFC_Font_Bytes(font_handle, 0, 2);
+	uint8_t header_size   = header[1];
+	uint8_t header_len    = _LFC_Header_Len(header[0], header_size);
+
+	if(header_len==0){
+		return 2; // Error signature, format error
+	}
+
+	// Header size of the format (paged C9 headers have the page index offset)
+	if(header_size!=header_len){
+		return 3; // Error structure length
+	}
+
+	uint8_t result = _LFC_Parse_Header(font_handle);
+	if(result){
+		return result;
+	}
+
+	if(font_handle->format==LFC_C9_FONT_SIGNATURE){
+		LFC_OFFSET index_offset = 0;
+		if(header_len>LFC_C9_FONT_HEADER_LEN){
+			index_offset = _LFC_Read_Offset(_LFC_Font_Bytes(font_handle, LFC_C9_FONT_HEADER_LEN, font_handle->offset_size), font_handle->offset_size);
+		}
+		return _LFC_Check_C9_Font(font_handle, index_offset);
+	}
+
+	uint16_t chr_count   = font_handle->character_count;
+	uint32_t last_offset = header_size + (uint32_t)chr_count * font_handle->offset_stride; // Start of the character data
+	LFC_OFFSET chr_offset;
+
+	for(uint16_t i=0;i<chr_count;i++){
+		chr_offset = _LFC_Chr_Offset(font_handle, i);
+
+		if(last_offset>chr_offset){
+			return 4; // Offset address error
+		}
+
+		last_offset=chr_offset;
+	}
+
+	return 0; // Success
+}
+
+
+
+/**
+ * @brief Font validation through a font handle for a font of known size
+ *
+ * @param font_handle: Font handle with data or source set
+ * @param size: Font size in bytes
+ *
+ * @return: Same codes as LFC_Check_Font
+ *
+ * The header and the page index header are checked against the size
+ * before they are parsed, then the tables and every glyph.
+ */
+
+static uint8_t _LFC_Check_Handle_Size(LFC_FONT * font_handle, uint32_t size){
+
+	if(size<2){
+		return 3; // Error structure length
+	}
+
+	uint8_t font[LFC_C9W_PAGED_HEADER_LEN];
+	memcpy(font, _LFC_Font_Bytes(font_handle, 0, 2), 2);
+
+	// Header length of the font format (wide fonts are unknown with LFC_OFFSET_16)
+	uint8_t header_len = _LFC_Header_Len(font[0], font[1]);
+	if(header_len==0){
+		return 2; // Error signature, format error
+	}
+
+	if(size<header_len || font[1]>size){
+		return 3; // Error structure length
+	}
+
+	memcpy(font, _LFC_Font_Bytes(font_handle, 0, header_len), header_len);
+
+	uint8_t  wide        = (font[0]==LFC_C8W_FONT_SIGNATURE || font[0]==LFC_C9W_FONT_SIGNATURE);
+	uint8_t  offset_size = wide ? 4 : 2;
+	uint32_t chr_count   = font[3] | ((uint16_t)font[4] << 8);
+	uint32_t tables_end;
+
+	// End of the font tables, computed in 32 bits (16-bit offsets of a broken header can wrap)
+	if(font[0]==LFC_C9_FONT_SIGNATURE || font[0]==LFC_C9W_FONT_SIGNATURE){
+		uint32_t range_count = font[5] | ((uint16_t)font[6] << 8);
+		tables_end = font[1] + range_count * LFC_C9_RANGE_SIZE + chr_count * offset_size;
+
+		uint8_t paged_len = wide ? LFC_C9W_PAGED_HEADER_LEN : LFC_C9_PAGED_HEADER_LEN;
+		uint32_t index_offset = (font[1]==paged_len) ? _LFC_Read_Offset(&font[7], offset_size) : 0;
+
+		if(index_offset){
+			if(index_offset>size || size-index_offset<LFC_C9_PAGE_HEADER_SIZE){
+				return 5; // Error page index
+			}
+			const uint8_t *index = _LFC_Font_Bytes(font_handle, index_offset, LFC_C9_PAGE_HEADER_SIZE);
+			uint32_t page_count  = index[2] | ((uint16_t)index[3] << 8);
+			uint32_t block_count = index[4] | ((uint16_t)index[5] << 8);
+			tables_end = index_offset + LFC_C9_PAGE_HEADER_SIZE + page_count * 2 + block_count * LFC_C9_PAGE_BLOCK_SIZE;
+		}
+	}else{
+		tables_end = font[1] + chr_count * (4 + offset_size);
+	}
+
+	if(tables_end>size){
+		return 3; // Error structure length
+	}
+
+	uint8_t result = _LFC_Check_Handle(font_handle);
+	if(result){
+		return result;
+	}
+
+	// Character headers and bitmaps
+	for(uint16_t i=0;i<chr_count;i++){
+		uint32_t ind = _LFC_Chr_Offset(font_handle, i);
+
+		if(ind>size || size-ind<5){
+			return 4; // Error offset address
+		}
+
+		const uint8_t *header = _LFC_Font_Bytes(font_handle, ind, 2);
+		if(size-ind-5 < (((uint32_t)header[0] * header[1] + 7) >> 3)){
+			return 4; // Error offset address
+		}
+	}
+
+	return 0; // Success
+}
+
+
+
+/*
+ * @brief Font validation function
+ *
+ * @param font: C8 or C9 font array (or a wide variant)
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error signature, format error
+ * 			3: Error structure length
+ * 			4: Error offset address
+ * 			5: Error page index (C9)
+ *
+ */
+uint8_t LFC_Check_Font(const uint8_t * font){
+
+	if(font==NULL){
+		return 1; // Error NULL pointer
+	}
+
+	LFC_FONT font_handle;
+	font_handle.data   = font;
+	font_handle.source = NULL;
+
+	return _LFC_Check_Handle(&font_handle);
+}
+
+
+
+/*
+ * @brief Font validation function for a font of known size
+ *
+ * @param font: C8 or C9 font array (or a wide variant)
+ * @param size: Font size in bytes
+ *
+ * @return: Same codes as LFC_Check_Font
+ *
+ * Same checks as LFC_Check_Font, and no table or glyph may reach past
+ * size bytes. Use it for fonts loaded at run time (files, font packs),
+ * LFC_Check_Font trusts the font tables.
+ */
+uint8_t LFC_Check_Font_Size(const uint8_t * font, uint32_t size){
+
+	if(font==NULL){
+		return 1; // Error NULL pointer
+	}
+
+	LFC_FONT font_handle;
+	font_handle.data   = font;
+	font_handle.source = NULL;
+
+	return _LFC_Check_Handle_Size(&font_handle, size);
+}
+
+
+
+/*
+ * @brief Font validation through a font source
+ *
+ * @param source: Initialized font source
+ * @param size: Font size in bytes
+ *
+ * @return: Same codes as LFC_Check_Font_Size, 3 also if a read failed
+ *
+ * Runs the LFC_Check_Font_Size checks on the font in the external memory.
+ * Every table entry and glyph header is read, so call it once after the
+ * font is written, not before every LFC_Load_Font_Source.
+ */
+uint8_t LFC_Check_Font_Source(LFC_FONT_SOURCE * source, uint32_t size){
+
+	if(source==NULL || source->blocks==NULL){
+		return 1; // Error NULL pointer
+	}
+
+	LFC_FONT font_handle;
+	font_handle.data   = NULL;
+	font_handle.source = source;
+
+	uint32_t errors = source->errors;
+	uint8_t  result = _LFC_Check_Handle_Size(&font_handle, size);
+
+	if(result==0 && source->errors!=errors){
+		return 3; // Read failed, font read as zeros
+	}
+
+	return result;
+}
+
+
+
+/**
+ * @brief Sets up direct index lookup, number characters and tabular cells
+ *
+ * @param font_handle: Font handle with the parsed header
+ */
+
+static void _LFC_Setup_Font(LFC_FONT * font_handle){
+
+	// C9 fonts store the ranges, take the longest one for direct index lookup
+	for(uint16_t r = 0; r < font_handle->range_count; r++){
+		const uint8_t *range = _LFC_Font_Bytes(font_handle, font_handle->cmap + (uint32_t)r * LFC_C9_RANGE_SIZE, LFC_C9_RANGE_SIZE);
+		uint16_t length = range[4] | ((uint16_t)range[5] << 8);
+		if(length > font_handle->direct_count){
+			font_handle->direct_first = range[0] | ((uint32_t)range[1] << 8) | ((uint32_t)range[2] << 16) | ((uint32_t)range[3] << 24);
+			font_handle->direct_start = range[6] | ((uint16_t)range[7] << 8);
+			font_handle->direct_count = length;
+		}
+	}
+
+	// Find the longest range of consecutive code points for direct index lookup
+	uint16_t run_start = 0;
+	for(uint16_t i = 1; font_handle->format == LFC_C8_FONT_SIGNATURE && i <= font_handle->character_count; i++){
+		if(i == font_handle->character_count || _LFC_Cmap_Code(font_handle, i) != _LFC_Cmap_Code(font_handle, i - 1) + 1){
+			if(i - run_start > font_handle->direct_count){
+				font_handle->direct_start = run_start;
+				font_handle->direct_count = i - run_start;
+			}
+			run_start = i;
+		}
+	}
+
+	if(font_handle->direct_count && font_handle->format == LFC_C8_FONT_SIGNATURE){
+		font_handle->direct_first = _LFC_Cmap_Code(font_handle, font_handle->direct_start);
+	}
+
+	// Look up the number characters once for the number print functions
+	for(uint8_t i = 0; i < LFC_NUMBER_CHARS; i++){
+		font_handle->number_chars[i] = _LFC_Font_Chr_Index(font_handle, _lfc_number_codes[i]);
+	}
+	font_handle->number_ready = 1;
+
+	// Tabular cell widths
+	_LFC_Font_Cells(font_handle);
+}
+
+
+
+/*
+ * @brief Validate a font and build its font handle
+ *
+ * @param font_handle: Output font handle
+ * @param font: C8 or C9 font array
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error signature, format error
+ * 			3: Error structure length
+ * 			4: Error offset address
+ *
+ * The font is checked with LFC_Check_Font once, the header is parsed once.
+ * Print forms that reference the handle skip both on every call. The
+ * longest range of consecutive code points (ASCII in most fonts) is found
+ * here, its characters are looked up by direct index instead of a search.
+ * For C9 fonts this is the longest range of the range table.
+ */
+uint8_t LFC_Load_Font(LFC_FONT * font_handle, const uint8_t * font){
+
+	if(font_handle==NULL){
+		return 1; // Error NULL pointer
+	}
+
+	uint8_t result = LFC_Check_Font(font);
+	if(result){
+		return result;
+	}
+
+	result = _LFC_Parse_Font(font, font_handle);
+	if(result){
+		return result;
+	}
+
+	_LFC_Setup_Font(font_handle);
+
+	return 0;
+}
+
+
+
+/*
+ * @brief Build a font handle for a font in a font source
+ *
+ * @param font_handle: Output font handle
+ * @param source: Initialized font source
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error signature, format error
+ * 			3: Error structure length
+ *
+ * Only the header is validated, check the font with LFC_Check_Font_Source
+ * once after it is written to the external memory.
+ */
+uint8_t LFC_Load_Font_Source(LFC_FONT * font_handle, LFC_FONT_SOURCE * source){
+
+	if(font_handle==NULL || source==NULL || source->blocks==NULL){
+		return 1; // Error NULL pointer
+	}
+
+	font_handle->data   = NULL;
+	font_handle->source = source;
+
+	const uint8_t *header = LFC_Source_Read(source, 0, 2);
+	uint8_t header_size   = header[1];
+	uint8_t header_len    = _LFC_Header_Len(header[0], header_size);
+
+	if(header_len==0){
+		return 2; // Error signature, format error
+	}
+
+	// Header size of the format (paged C9 headers have the page index offset)
+	if(header_size!=header_len){
+		return 3; // Error structure length
+	}
+
+	uint8_t result = _LFC_Parse_Header(font_handle);
+	if(result){
+		return result;
+	}
+
+	_LFC_Setup_Font(font_handle);
+
+	return 0;
+}
+
+
+
+/*
+ * @brief Renders UTF-32 code character
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-32 character code
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering complete string (next caret position)
+ *
+ */
+
+int16_t LFC_Print_Utf32_Chr(PRINT_FORM *print_form,uint32_t chr,int16_t pos_x,int16_t pos_y){
+
+	// Check null pointer
+	if(print_form==NULL){
+		return 0;
+	}
+	if(print_form->display_context==NULL){
+		return 0;
+	}
+
+	// Codes without UTF-8 encoding
+	if(chr>=0x80000000){
+		return 0;
+	}
+
+	return LFC_Print_Utf32_Str(print_form, &chr, 1, pos_x, pos_y);
+}
+
+
+
+
+
+uint8_t LFC_Utf32_Char_Rect(PRINT_FORM *print_form, const uint32_t chr,int16_t x,int16_t y,LFC_RECT *rect){
+	// Check null pointer
+	if(print_form==NULL){
+		return 0;
+	}
+	if(print_form->display_context==NULL){
+		return 0;
+	}
+
+	// Codes without UTF-8 encoding
+	if(chr>=0x80000000){
+		return 0;
+	}
+
+	return LFC_Str_Rect_Utf32(print_form, &chr, 1, x, y, rect);
+
+}
+
+
+
+/*
+ * @brief Renders UTF-32 code array to display
+ *
+ * @param print_form: Font properties
+ * @param str   : UTF-32 character codes
+ * @param length: Number of codes (the text also ends at a zero code)
+ * @param pos_x : Starting X coordinate
+ * @param pos_y : Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the codes (next caret position)
+ *
+ * Same output as LFC_Print of the UTF-8 encoded text, the codes are looked
+ * up directly without UTF-8 conversion.
+ */
+
+int16_t LFC_Print_Utf32_Str(PRINT_FORM * print_form, const uint32_t * str, uint16_t length, int16_t pos_x, int16_t pos_y){
+
+	// Check null pointer
+	if(print_form==NULL || str==NULL){
+		return 0;
+	}
+
+	LFC_TEXT text;
+	_LFC_Text_Utf32(&text, str, length);
+
+	return _LFC_Print_Text(print_form, &text, pos_x, pos_y);
+}
+
+
+
+/*
+ * @brief Calculates the bounding rectangle for a UTF-32 code array without rendering it
+ *
+ * @param print_form: Font properties
+ * @param str   : UTF-32 character codes
+ * @param length: Number of codes (the text also ends at a zero code)
+ * @param x     : Starting X coordinate
+ * @param y     : Starting Y coordinate
+ * @param rect  : Output rectangle structure
+ *
+ * @return: 0 on success, 1 on error
+ */
+
+uint8_t LFC_Str_Rect_Utf32(PRINT_FORM * print_form, const uint32_t * str, uint16_t length, int16_t x, int16_t y, LFC_RECT *rect){
+
+	if(print_form==NULL || str==NULL){
+		return 1;
+	}
+
+	LFC_TEXT text;
+	_LFC_Text_Utf32(&text, str, length);
+
+	LFC_FONT raw_font;
+	return _LFC_Str_Rect(print_form, _LFC_Form_Font(print_form, &raw_font), &text, x, y, rect);
+}
+
+
+
+/**
+ * @brief Shapes a text source into a glyph run
+ *
+ * @return: Number of glyphs written
+ */
+
+static uint16_t _LFC_Shape_Text(PRINT_FORM * print_form, LFC_TEXT * text, LFC_GLYPH * glyphs, uint16_t max_glyphs){
+
+	LFC_FONT raw_font;
+	const LFC_FONT *font_handle = _LFC_Form_Font(print_form, &raw_font);
+	if(font_handle==NULL){
+		return 0;
+	}
+
+	uint16_t count = 0;
+
+	// Stop at the end of the array, the end of the text or a conversion error
+	while(count<max_glyphs && _LFC_Next_Glyph(print_form, font_handle, text, &glyphs[count])==LFC_TEXT_GLYPH){
+		count++;
+	}
+
+	return count;
+}
+
+
+
+/*
+ * @brief Shapes UTF-8 string into a glyph run
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-8 encoded input string
+ * @param glyphs: Output glyph array (caller-owned)
+ * @param max_glyphs: Size of the glyph array
+ *
+ * @return: Number of glyphs written, shaping stops at the end of the array
+ *          or at an invalid UTF-8 sequence
+ *
+ * Every character is decoded and looked up once. Text that is redrawn
+ * often (labels, icons, tickers) can be shaped at startup and drawn by
+ * LFC_Draw_Run at any position.
+ */
+
+uint16_t LFC_Shape(PRINT_FORM * print_form, const uint8_t * str, LFC_GLYPH * glyphs, uint16_t max_glyphs){
+
+	// Check null pointer
+	if(print_form==NULL || str==NULL || glyphs==NULL){
+		return 0;
+	}
+
+	LFC_TEXT text;
+	_LFC_Text_Utf8(&text, str);
+
+	return _LFC_Shape_Text(print_form, &text, glyphs, max_glyphs);
+}
+
+
+
+/*
+ * @brief Shapes UTF-32 code array into a glyph run
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-32 character codes
+ * @param length: Number of codes (the text also ends at a zero code)
+ * @param glyphs: Output glyph array (caller-owned)
+ * @param max_glyphs: Size of the glyph array
+ *
+ * @return: Number of glyphs written, shaping stops at the end of the array
+ *          or at an invalid UTF-32 code
+ *
+ * Same run as LFC_Shape of the UTF-8 encoded text, the codes are looked
+ * up directly without UTF-8 conversion.
+ */
+
+uint16_t LFC_Shape_Utf32(PRINT_FORM * print_form, const uint32_t * str, uint16_t length, LFC_GLYPH * glyphs, uint16_t max_glyphs){
+
+	// Check null pointer
+	if(print_form==NULL || str==NULL || glyphs==NULL){
+		return 0;
+	}
+
+	LFC_TEXT text;
+	_LFC_Text_Utf32(&text, str, length);
+
+	return _LFC_Shape_Text(print_form, &text, glyphs, max_glyphs);
+}
+
+
+
+/**
+ * @brief Measures a glyph run at the left / baseline origin
+ */
+
+static void _LFC_Run_Measure(const PRINT_FORM * print_form, const LFC_GLYPH * glyphs, uint16_t count, int16_t x, int16_t y, LFC_RECT *rect){
+
+	LFC_MEASURE measure;
+
+	// Initialize rectangle
+	rect->height = 0;
+	rect->width = 0;
+	rect->x = x;
+	rect->y = y;
+
+	_LFC_Measure_Start(&measure, y);
+
+	for(uint16_t i=0; i<count; i++){
+		_LFC_Measure_Glyph(print_form, &measure, &glyphs[i]);
+	}
+
+	_LFC_Measure_End(print_form, &measure, rect);
+}
+
+
+
+/*
+ * @brief Calculates the bounding rectangle for a glyph run without rendering it
+ *
+ * @param print_form: Font properties
+ * @param glyphs: Glyph run made by LFC_Shape
+ * @param count: Number of glyphs
+ * @param x  : Starting X coordinate
+ * @param y  : Starting Y coordinate
+ * @param rect: Output rectangle structure
+ *
+ * @return: 0 on success, 1 on error
+ *
+ * Same rectangle as LFC_Str_Rect of the shaped string, computed from the
+ * glyph metrics only.
+ */
+
+uint8_t LFC_Run_Rect(PRINT_FORM * print_form, const LFC_GLYPH * glyphs, uint16_t count, int16_t x, int16_t y, LFC_RECT *rect){
+
+	if(print_form==NULL || glyphs==NULL || rect==NULL){
+		return 1;
+	}
+
+	_LFC_Run_Measure(print_form, glyphs, count, x, y, rect);
+	_LFC_Anchor_Rect(print_form->config, rect, x, y);
+
+	return 0;
+}
+
+
+
+/**
+ * @brief Renders shaped glyphs with the print form options (padding, bounding box, anchor)
+ *
+ * @param print_form: Font properties
+ * @param font_handle: Font of the print form
+ * @param glyphs: Shaped glyphs
+ * @param count: Number of glyphs
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the glyphs
+ */
+
+static int16_t _LFC_Draw_Glyphs(PRINT_FORM * print_form, const LFC_FONT * font_handle, const LFC_GLYPH * glyphs, uint16_t count, int16_t pos_x, int16_t pos_y){
+
+	pos_x+=print_form->padding;
+	pos_y+=print_form->padding;
+
+	// Move the measured box and the baseline to the anchor point
+	LFC_RECT rect;
+	if(print_form->config & (LFC_BOUNDING_BOX | LFC_ANCHOR_H_MASK | LFC_ANCHOR_V_MASK)){
+		_LFC_Run_Measure(print_form,glyphs,count,pos_x,pos_y,&rect);
+
+		int16_t measured_y = rect.y;
+		_LFC_Anchor_Rect(print_form->config, &rect, pos_x - print_form->padding, pos_y - print_form->padding);
+		pos_y += rect.y - measured_y;
+	}
+
+	// If set boundary box draw it, inverted text only punches out the glyph pixels
+	LFC_RECT punch;
+	uint8_t fill=0;
+	if(print_form->config & LFC_BOUNDING_BOX){
+		if(print_form->config & LFC_INVERT){
+			fill=1;
+		}
+		LFC_Draw_Rect(print_form->display_context,&rect, fill,0);
+		punch = rect;
+	}
+
+	int16_t px = _LFC_Draw_Lines(print_form, font_handle, glyphs, count, NULL, &rect, pos_x, pos_y, fill ? &punch : NULL);
+
+	if(print_form->config & LFC_BOUNDING_BOX){
+		return px+2*print_form->padding;
+	}
+	return px;
+}
+
+
+
+/*
+ * @brief Renders a glyph run to display
+ *
+ * @param print_form: Font properties
+ * @param glyphs: Glyph run made by LFC_Shape
+ * @param count: Number of glyphs
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the run (next caret position)
+ *
+ * The run must be drawn with the print form font it was shaped with.
+ * Invert, bounding box, padding and anchor are applied as in LFC_Print,
+ * spacing is already part of the glyph advances.
+ */
+
+int16_t LFC_Draw_Run(PRINT_FORM * print_form, const LFC_GLYPH * glyphs, uint16_t count, int16_t pos_x, int16_t pos_y){
+
+	// Check null pointer
+	if(print_form==NULL || glyphs==NULL){
+		return 0;
+	}
+	if(print_form->display_context==NULL){
+		return 0;
+	}
+
+	LFC_FONT raw_font;
+	const LFC_FONT *font_handle = _LFC_Form_Font(print_form, &raw_font);
+	if(font_handle==NULL){
+		return 0;
+	}
+
+	return _LFC_Draw_Glyphs(print_form, font_handle, glyphs, count, pos_x, pos_y);
+}
+
+
+
+// Powers of ten of the 32-bit decimal digits, digits are found by subtraction
+static const uint32_t _lfc_pow10[10] = {
+	1000000000, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1
+};
+
+
+/**
+ * @brief Converts an unsigned value to decimal digits without division
+ *
+ * @param value: Value
+ * @param min_digits: Minimum digits (leading zeros), 1-10
+ * @param digits: Output digits 0-9, most significant first (10 bytes)
+ *
+ * @return: Number of digits
+ *
+ * Each digit is counted by subtracting its power of ten (at most 9 times),
+ * cores without a hardware divider do not call the division routine.
+ */
+
+static uint8_t _LFC_Decimal_Digits(uint32_t value, uint8_t min_digits, uint8_t * digits) {
+
+	uint8_t count = 0;
+
+	for(uint8_t i = 0; i < 10; i++){
+
+		uint32_t power = _lfc_pow10[i];
+		uint8_t  digit = 0;
+
+		while(value >= power){
+			value -= power;
+			digit++;
+		}
+
+		if(digit || count || (10 - i) <= min_digits){
+			digits[count++] = digit;
+		}
+	}
+
+	return count;
+}
+
+
+/**
+ * @brief Renders number characters
+ *
+ * @param print_form: Font properties
+ * @param chars: Number character indexes (_lfc_number_codes)
+ * @param count: Number of characters
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the number
+ *
+ * With a font handle from LFC_Load_Font the character data offsets come
+ * from the handle, the character map is not searched.
+ */
+
+static int16_t _LFC_Print_Number(PRINT_FORM * print_form, const uint8_t * chars, uint8_t count, int16_t pos_x, int16_t pos_y) {
+
+	// Check null pointer
+	if(print_form==NULL || print_form->display_context==NULL){
+		return 0;
+	}
+
+	LFC_FONT raw_font;
+	const LFC_FONT *font_handle = _LFC_Form_Font(print_form, &raw_font);
+	if(font_handle==NULL){
+		return 0;
+	}
 
+	LFC_GLYPH glyphs[LFC_NUMBER_MAX];
 
-	int16_t max_width=0;
+	for(uint8_t i = 0; i < count; i++){
+		LFC_OFFSET cind;
+		if(font_handle->number_ready){
+			cind = font_handle->number_chars[chars[i]];
+		}else{
+			cind = _LFC_Font_Chr_Index(font_handle, _lfc_number_codes[chars[i]]);
+		}
+		_LFC_Shape_Offset(print_form, font_handle, cind, &glyphs[i]);
 
+		if(print_form->tabular != LFC_PROPORTIONAL){
+			_LFC_Tabular_Glyph(print_form, font_handle, chars[i] < 10, &glyphs[i]);
+		}
+	}
 
-	// Calculate dimensions for each character
-	while (*s) {
+	return _LFC_Draw_Glyphs(print_form, font_handle, glyphs, count, pos_x, pos_y);
+}
 
-		// Handle newline character
-		if(*s=='\n'){
-			py-=font_height+1; // Move to next line
-			s++;
 
-			// Remove last space in the end of line
-			if(print_form->config & (LFC_SPACING)){
-				rect_width -= print_form->spacing;
-			}
+/**
+ * @brief Adds the padding and the digits of a number
+ *
+ * @param chars: Output number character indexes (LFC_NUMBER_MAX bytes)
+ * @param sign: Sign character index, 0: no sign
+ * @param digits: Digits (or hex digits), most significant first
+ * @param digit_count: Number of digits
+ * @param decimals: Digits after the decimal point, 0: no point
+ * @param width: Minimum characters
+ * @param options: LFC_NUMBER_ZERO_PAD
+ *
+ * @return: Number of characters
+ */
 
-			if(max_width<rect_width){
-				max_width=rect_width;
-			}
-			rect_width=0;
+static uint8_t _LFC_Number_Chars(uint8_t * chars, uint8_t sign, const uint8_t * digits, uint8_t digit_count, uint8_t decimals, uint8_t width, uint8_t options) {
 
-			continue;
+	uint8_t length = digit_count + (decimals ? 1 : 0) + (sign ? 1 : 0);
+	uint8_t pad    = 0;
+	uint8_t count  = 0;
+
+	if(width > LFC_NUMBER_MAX){
+		width = LFC_NUMBER_MAX;
+	}
+	if(width > length){
+		pad = width - length;
+	}
+
+	// Spaces before the sign, zeros after it
+	if(!(options & LFC_NUMBER_ZERO_PAD)){
+		while(pad){
+			chars[count++] = LFC_NUMBER_SPACE;
+			pad--;
 		}
+	}
 
-		// Convert UTF-8 to UTF-32
-		uint8_t u8_len = LFC_Utf8_To_Utf32(s, u32_code);
-		if (u8_len == 0) {
-			return 0;
-		} else {
-			s += u8_len;
+	if(sign){
+		chars[count++] = sign;
+	}
+
+	while(pad){
+		chars[count++] = 0;
+		pad--;
+	}
+
+	for(uint8_t i = 0; i < digit_count; i++){
+		if(decimals && i == digit_count - decimals){
+			chars[count++] = LFC_NUMBER_POINT;
 		}
+		chars[count++] = digits[i];
+	}
+
+	return count;
+}
+
+
+
+/*
+ * @brief Renders a fixed-point decimal number without formatting it to a string
+ *
+ * @param print_form: Font properties
+ * @param value: Value scaled by 10^decimals (1234 with 2 decimals: 12.34)
+ * @param decimals: Digits after the decimal point (0-9)
+ * @param width: Minimum characters (sign and point included), padded with spaces or zeros
+ * @param options: LFC_NUMBER_ZERO_PAD, LFC_NUMBER_PLUS
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the number (next caret position)
+ *
+ * Print form options (spacing, invert, bounding box, padding, anchor) are
+ * applied as in LFC_Print.
+ */
 
+int16_t LFC_Print_Fixed(PRINT_FORM * print_form, int32_t value, uint8_t decimals, uint8_t width, uint8_t options, int16_t pos_x, int16_t pos_y){
 
-		// Get character offset in the font array
-		cind = LFC_Get_Chr_Index(font, u32_code, character_count, cmap_start);
+	uint8_t digits[10];
+	uint8_t chars[LFC_NUMBER_MAX];
+	uint8_t sign = 0;
 
-		if (cind) {
-			// Read character metrics from font
-			chr_width   = font[cind++]; // Bitmap width
-			chr_height  = font[cind++]; // Bitmap height
-			chr_top     = font[cind++]; // Top offset
-			chr_left    = font[cind++]; // Left offset
-			chr_advance = font[cind++]; // character width
+	if(decimals > 9){
+		decimals = 9;
+	}
 
+	// Magnitude in unsigned arithmetic (INT32_MIN has no positive value)
+	uint32_t magnitude = (uint32_t)value;
+	if(value < 0){
+		magnitude = 0u - magnitude;
+		sign = LFC_NUMBER_MINUS;
+	}else if(options & LFC_NUMBER_PLUS){
+		sign = LFC_NUMBER_SIGN;
+	}
 
-			if(chr_width>chr_advance){
-				rect_width+=chr_width;
-			}else{
-				rect_width+=chr_advance;
-			}
+	// At least one digit before the decimal point
+	uint8_t digit_count = _LFC_Decimal_Digits(magnitude, decimals + 1, digits);
+	uint8_t count = _LFC_Number_Chars(chars, sign, digits, digit_count, decimals, width, options);
 
-			if(print_form->config & (LFC_SPACING) ){
-				rect_width += print_form->spacing;
-			}
+	return _LFC_Print_Number(print_form, chars, count, pos_x, pos_y);
+}
 
-			rect_width += chr_left;
 
-			// Calculate top Y coordinate of character
-			int16_t base_line = py - (chr_height  - chr_top);
 
-			// Update bounding box
-			if (min_y > base_line) {
-				min_y = base_line;
-			}
+/*
+ * @brief Renders a decimal integer without formatting it to a string
+ *
+ * @param print_form: Font properties
+ * @param value: Integer value
+ * @param width: Minimum characters (sign included), padded with spaces or zeros
+ * @param options: LFC_NUMBER_ZERO_PAD, LFC_NUMBER_PLUS
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the number (next caret position)
+ */
+
+int16_t LFC_Print_Int(PRINT_FORM * print_form, int32_t value, uint8_t width, uint8_t options, int16_t pos_x, int16_t pos_y){
+	return LFC_Print_Fixed(print_form, value, 0, width, options, pos_x, pos_y);
+}
+
+
+
+/*
+ * @brief Renders an unsigned hexadecimal number (upper case digits, no prefix)
+ *
+ * @param print_form: Font properties
+ * @param value: Value
+ * @param width: Minimum digits, padded with spaces or zeros
+ * @param options: LFC_NUMBER_ZERO_PAD
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the number (next caret position)
+ */
+
+int16_t LFC_Print_Hex(PRINT_FORM * print_form, uint32_t value, uint8_t width, uint8_t options, int16_t pos_x, int16_t pos_y){
 
-			if (max_y < (base_line + chr_height)) {
-				max_y = base_line + chr_height;
+	uint8_t digits[8];
+	uint8_t chars[LFC_NUMBER_MAX];
+	uint8_t digit_count = 0;
+
+	// Nibbles from the most significant one, leading zeros are skipped
+	for(int8_t shift = 28; shift >= 0; shift -= 4){
+		uint8_t digit = (value >> shift) & 0x0F;
+		if(digit || digit_count || shift == 0){
+			digits[digit_count++] = digit;
+		}
+	}
+
+	uint8_t count = _LFC_Number_Chars(chars, 0, digits, digit_count, 0, width, options);
+
+	return _LFC_Print_Number(print_form, chars, count, pos_x, pos_y);
+}
+
+
+
+// Text box layout state of the current line
+typedef struct{
+	uint16_t start;       // First byte of the line
+	int16_t  width;       // Sum of glyph advances
+	uint16_t glyphs;      // Glyphs in the line
+	uint16_t brk;         // Byte offset of the last space in the line, 0xFFFF: none
+	int16_t  brk_width;   // Advances before the space
+	uint16_t brk_glyphs;  // Glyphs before the space
+	int16_t  after_width; // Advances up to and including the space
+}LFC_LAYOUT_LINE;
+
+
+/**
+ * @brief Stores a line in the line table of a layout
+ *
+ * @param print_form: Font properties
+ * @param layout: Text box layout
+ * @param start: First byte of the line
+ * @param end: Byte after the line
+ * @param width: Sum of glyph advances
+ * @param glyphs: Glyphs in the line
+ *
+ * @return: 1 if the line table is full after the line
+ */
+
+static uint8_t _LFC_Layout_Line(const PRINT_FORM * print_form, LFC_TEXT_LAYOUT * layout, uint16_t start, uint16_t end, int16_t width, uint16_t glyphs) {
+
+	// Spacing after the last glyph is not part of the line
+	if(glyphs && (print_form->config & LFC_SPACING)){
+		width -= print_form->spacing;
+	}
+
+	LFC_TEXT_LINE *line = &layout->lines[layout->line_count++];
+	line->start  = start;
+	line->length = end - start;
+	line->width  = (width > 0) ? width : 0;
+
+	return layout->line_count >= layout->max_lines;
+}
+
+
+
+/*
+ * @brief Wraps UTF-8 text into lines of a text box
+ *
+ * @param print_form: Font properties
+ * @param layout: Text box layout, lines and max_lines are set by the caller
+ * @param str: UTF-8 encoded input text (not copied, kept until the layout is drawn)
+ * @param length: Bytes in the text (the text also ends at a zero byte)
+ * @param width: Box width in pixels
+ *
+ * @return: Number of lines
+ *
+ * The text is shaped once, line breaks are placed at the last space that
+ * fits (the space is dropped), a word wider than the box is broken between
+ * characters and newline characters always break. The line table is reused
+ * by LFC_Draw_Text_Box for every repaint and scroll position without
+ * measuring again. Layout stops when the line table is full.
+ */
+
+uint16_t LFC_Layout_Text(PRINT_FORM * print_form, LFC_TEXT_LAYOUT * layout, const uint8_t * str, uint16_t length, uint16_t width){
+
+	// Check null pointer
+	if(print_form==NULL || layout==NULL || str==NULL){
+		return 0;
+	}
+
+	layout->line_count = 0;
+	layout->text       = str;
+	layout->ascent     = 0;
+
+	if(layout->lines==NULL || layout->max_lines==0){
+		return 0;
+	}
+
+	LFC_FONT raw_font;
+	const LFC_FONT *font_handle = _LFC_Form_Font(print_form, &raw_font);
+	if(font_handle==NULL){
+		return 0;
+	}
+
+	int8_t spacing = (print_form->config & LFC_SPACING) ? print_form->spacing : 0;
+
+	LFC_TEXT  text;
+	LFC_GLYPH glyph;
+	LFC_LAYOUT_LINE line;
+
+	_LFC_Text_Utf8_N(&text, str, length);
+
+	line.start       = 0;
+	line.width       = 0;
+	line.glyphs      = 0;
+	line.brk         = 0xFFFF;
+	line.brk_width   = 0;
+	line.brk_glyphs  = 0;
+	line.after_width = 0;
+
+	while(1){
+
+		uint16_t pos = text.utf8 - str;
+
+		if(_LFC_Next_Glyph(print_form, font_handle, &text, &glyph) != LFC_TEXT_GLYPH){
+			break; // End of text or conversion error
+		}
+
+		uint16_t next = text.utf8 - str;
+
+		// Newline always breaks, the newline character is dropped
+		if(glyph.type == LFC_GLYPH_NEWLINE){
+			if(_LFC_Layout_Line(print_form, layout, line.start, pos, line.width, line.glyphs)){
+				return layout->line_count;
 			}
+			line.start  = next;
+			line.width  = 0;
+			line.glyphs = 0;
+			line.brk    = 0xFFFF;
+			continue;
+		}
 
-		}else{
-			// Unknown character
-			uint8_t missing_char_width=MISSING_CHAR_SIZE(font_height);
-			rect_width+=missing_char_width;
+		uint8_t space = (str[pos] == ' ');
+
+		// Line is full
+		if(line.glyphs && (line.width + glyph.advance - spacing) > (int16_t)width){
+
+			if(space){
+				// Break at this space
+				if(_LFC_Layout_Line(print_form, layout, line.start, pos, line.width, line.glyphs)){
+					return layout->line_count;
+				}
+				line.start  = next;
+				line.width  = 0;
+				line.glyphs = 0;
+				line.brk    = 0xFFFF;
+				continue;
+			}
 
-			if((missing_char_width+py)>max_y){
-				max_y = missing_char_width + py;
+			if(line.brk != 0xFFFF){
+				// Break at the last space, the rest of the word moves to the next line
+				if(_LFC_Layout_Line(print_form, layout, line.start, line.brk, line.brk_width, line.brk_glyphs)){
+					return layout->line_count;
+				}
+				line.start   = line.brk + 1;
+				line.width  -= line.after_width;
+				line.glyphs -= line.brk_glyphs + 1;
+				line.brk     = 0xFFFF;
 			}
-			if(min_y>py){
-				min_y=py;
+
+			// Word wider than the box: break between characters
+			if(line.glyphs && (line.width + glyph.advance - spacing) > (int16_t)width){
+				if(_LFC_Layout_Line(print_form, layout, line.start, pos, line.width, line.glyphs)){
+					return layout->line_count;
+				}
+				line.start  = pos;
+				line.width  = 0;
+				line.glyphs = 0;
 			}
 		}
+
+		if(space){
+			line.brk        = pos;
+			line.brk_width  = line.width;
+			line.brk_glyphs = line.glyphs;
+		}
+
+		line.width += glyph.advance;
+		line.glyphs++;
+
+		if(space){
+			line.after_width = line.width;
+		}
+
+		// First baseline is below the highest glyph
+		if(glyph.type == LFC_GLYPH_BITMAP && glyph.top > layout->ascent){
+			layout->ascent = glyph.top;
+		}
+		if(glyph.type == LFC_GLYPH_MISSING && glyph.height > layout->ascent){
+			layout->ascent = glyph.height;
+		}
 	}
 
-	if(max_width<rect_width){
-		max_width=rect_width;
+	// Last line
+	if(line.glyphs){
+		_LFC_Layout_Line(print_form, layout, line.start, text.utf8 - str, line.width, line.glyphs);
 	}
 
-	// Set final rectangle dimensions
-	rect->width = max_width;
-	rect->y = min_y;
-	rect->height = max_y - min_y;
+	return layout->line_count;
+}
 
 
-	// Apply padding
-	rect->width  += (2 * padding);
-	rect->height += (2 * padding);
 
-	rect->x -= padding;
-	rect->y -= padding;
+/*
+ * @brief Draws the lines of a text layout in a box
+ *
+ * @param print_form: Font properties (the font of the layout)
+ * @param layout: Text box layout made by LFC_Layout_Text
+ * @param box: Text box (rotated screen coordinates as LFC_Draw_Rect)
+ * @param first_line: First line drawn at the top of the box (scroll position)
+ * @param align: LFC_ALIGN_LEFT, LFC_ALIGN_CENTER or LFC_ALIGN_RIGHT
+ *
+ * @return: Number of lines drawn (fully or partly visible)
+ *
+ * Lines are drawn from the top of the box down, one font height + 1 apart
+ * as newlines in LFC_Print. Drawing is clipped to the box (and to the clip
+ * rectangle of the display), lines below the box are not shaped at all.
+ * Padding and bounding box of the print form are not used, the box can be
+ * filled by LFC_Draw_Rect before.
+ */
 
-	return 0;
+uint16_t LFC_Draw_Text_Box(PRINT_FORM * print_form, const LFC_TEXT_LAYOUT * layout, const LFC_RECT * box, uint16_t first_line, uint8_t align){
+
+	// Check null pointer
+	if(print_form==NULL || layout==NULL || box==NULL){
+		return 0;
+	}
+	if(print_form->display_context==NULL || layout->lines==NULL || layout->text==NULL){
+		return 0;
+	}
+
+	LFC_FONT raw_font;
+	const LFC_FONT *font_handle = _LFC_Form_Font(print_form, &raw_font);
+	if(font_handle==NULL){
+		return 0;
+	}
+
+	DISPLAY_CONTEXT *display_context = print_form->display_context;
+
+	// Clip to the box, inside the clip rectangle of the display
+	LFC_RECT *old_clip = display_context->clip_rect;
+	int16_t min_x = box->x;
+	int16_t max_x = box->x + box->width;
+	int16_t min_y = box->y;
+	int16_t max_y = box->y + box->height;
+
+	if(old_clip!=NULL){
+		if(min_x < old_clip->x){
+			min_x = old_clip->x;
+		}
+		if(max_x > old_clip->x + old_clip->width){
+			max_x = old_clip->x + old_clip->width;
+		}
+		if(min_y < old_clip->y){
+			min_y = old_clip->y;
+		}
+		if(max_y > old_clip->y + old_clip->height){
+			max_y = old_clip->y + old_clip->height;
+		}
+	}
+
+	if(min_x >= max_x || min_y >= max_y){
+		return 0;
+	}
+
+	LFC_RECT clip;
+	clip.x      = min_x;
+	clip.y      = min_y;
+	clip.width  = max_x - min_x;
+	clip.height = max_y - min_y;
+
+	display_context->clip_rect = &clip;
+
+	int16_t line_step = font_handle->height + 1;
+	int16_t top       = box->y + box->height;
+	uint16_t drawn    = 0;
+
+	for(uint16_t i = first_line; i < layout->line_count; i++){
+
+		// Line slot below the box
+		if(top <= box->y){
+			break;
+		}
+
+		const LFC_TEXT_LINE *line = &layout->lines[i];
+
+		int16_t x = box->x;
+		if(align == LFC_ALIGN_CENTER){
+			x += ((int16_t)box->width - (int16_t)line->width) / 2;
+		}else if(align == LFC_ALIGN_RIGHT){
+			x += (int16_t)box->width - (int16_t)line->width;
+		}
+
+		LFC_TEXT text;
+		_LFC_Text_Utf8_N(&text, layout->text + line->start, line->length);
+
+		_LFC_Print(print_form, font_handle, &text, x, top - layout->ascent, NULL);
+
+		top -= line_step;
+		drawn++;
+	}
+
+	display_context->clip_rect = old_clip;
+
+	return drawn;
 }
 
 
 
-/*
- * @brief Draws a rectangle on the display with optional filling
- * @param rect: Rectangle structure defining position and size
- * @param fill: 1 to fill rectangle, 0 for outline only
- * @param invert: Invert drawing colors
- * @return: 0 if successful, 1 if rectangle is completely off-screen
+/**
+ * @brief Calculates the pixel box of a text field cell
  *
- * This function handles rectangle drawing with proper clipping to screen
- * boundaries and supports both filled and outline rendering modes.
+ * @param cell: Text field cell
+ * @param y: Baseline of the field
+ * @param rect: Output rectangle (bitmap box, missing: the drawn box)
  */
 
-static uint8_t _LFC_Draw_Rect(DISPLAY_CONTEXT * display_context, LFC_RECT * rect, uint8_t fill, uint8_t invert) {
+static void _LFC_Cell_Rect(const LFC_FIELD_CELL * cell, int16_t y, LFC_RECT * rect) {
 
-	if(rect==NULL || display_context==NULL){
-		return 1;
+	if(cell->glyph.type == LFC_GLYPH_MISSING){
+		_LFC_Missing_Rect(&cell->glyph, cell->x, y, rect);
+	}else{
+		rect->x = cell->x + cell->glyph.left;
+		rect->y = y - (cell->glyph.height - cell->glyph.top);
+		rect->width  = cell->glyph.width;
+		rect->height = cell->glyph.height;
 	}
+}
 
 
-	CB_Set_Pixel set_pixel_fnc= display_context->set_pixel_func;
+/**
+ * @brief Grows a rectangle to cover another one (width 0: empty)
+ */
 
-	if(set_pixel_fnc==NULL){
-		return 1;
+static void _LFC_Rect_Union(LFC_RECT * rect, const LFC_RECT * add) {
+
+	if(add->width==0 || add->height==0){
+		return;
 	}
 
-	uint16_t screen_width  = display_context->width;
-	uint16_t screen_height = display_context->height;
+	if(rect->width==0){
+		*rect = *add;
+		return;
+	}
 
+	int16_t min_x = (add->x < rect->x) ? add->x : rect->x;
+	int16_t min_y = (add->y < rect->y) ? add->y : rect->y;
+	int16_t max_x = rect->x + rect->width;
+	int16_t max_y = rect->y + rect->height;
 
-	int16_t x, y;
-	int16_t max_x, min_x;
-	int16_t max_y, min_y;
+	if(max_x < add->x + add->width){
+		max_x = add->x + add->width;
+	}
+	if(max_y < add->y + add->height){
+		max_y = add->y + add->height;
+	}
 
-	uint8_t left_line   = 1;
-	uint8_t right_line  = 1;
-	uint8_t top_line    = 1;
-	uint8_t bottom_line = 1;
+	rect->x = min_x;
+	rect->y = min_y;
+	rect->width  = max_x - min_x;
+	rect->height = max_y - min_y;
+}
 
 
-	// Calculate rectangle boundaries
-	min_x=rect->x;
-	max_x=rect->x+rect->width;
 
-	min_y=rect->y;
-	max_y=rect->y+rect->height;
+/*
+ * @brief Initialize a text field
+ *
+ * @param field: Text field structure
+ * @param cells: Cell table (caller-provided), one cell per glyph
+ * @param max_cells: Size of the cell table
+ * @param x: Text start X coordinate
+ * @param y: Baseline Y coordinate
+ *
+ * The field is empty, the display is not changed.
+ */
+
+void LFC_Field_Init(LFC_TEXT_FIELD * field, LFC_FIELD_CELL * cells, uint16_t max_cells, int16_t x, int16_t y){
+
+	if(field==NULL){
+		return;
+	}
 
+	field->cells      = cells;
+	field->max_cells  = (cells!=NULL) ? max_cells : 0;
+	field->cell_count = 0;
+	field->x          = x;
+	field->y          = y;
+}
+
+
+
+/*
+ * @brief Updates the text of a text field, redraws only the changed glyphs
+ *
+ * @param print_form: Font properties (the same font and spacing for every update)
+ * @param field: Text field made by LFC_Field_Init
+ * @param str: UTF-8 encoded new text (single line, it ends at a newline)
+ * @param dirty: Output changed area (same coordinates as LFC_Str_Rect, width 0: nothing changed), can be NULL
+ *
+ * @return: 0 on success, 1 on error (the text is drawn up to a conversion error)
+ *
+ * The new text is shaped and compared with the cells of the last update.
+ * A cell whose glyph or position changed is erased to the background and
+ * drawn again, the unchanged cells are not touched (cells that overlap an
+ * erased cell are drawn again as well). Text longer than the cell table is
+ * cut. Bounding box, padding and anchor flags are not used by text fields.
+ */
+
+uint8_t LFC_Field_Update(PRINT_FORM * print_form, LFC_TEXT_FIELD * field, const uint8_t * str, LFC_RECT * dirty){
+
+	LFC_RECT changed;
+	changed.x = 0;
+	changed.y = 0;
+	changed.width  = 0;
+	changed.height = 0;
+
+	if(dirty!=NULL){
+		*dirty = changed;
+	}
 
-	//Check if rectangle is completely outside screen horizontally
-	if (((max_x < 0) && (min_x < 0))||((max_x > screen_width) && (min_x > screen_width))) {
+	// Check null pointer
+	if(print_form==NULL || field==NULL || str==NULL){
+		return 1;
+	}
+	if(print_form->display_context==NULL){
 		return 1;
 	}
 
-	//Check if rectangle is completely outside screen vertically
-	if (((max_y < 0) && (min_y < 0))||((max_y > screen_height) && (min_y > screen_height))) {
+	LFC_FONT raw_font;
+	const LFC_FONT *font_handle = _LFC_Form_Font(print_form, &raw_font);
+	if(font_handle==NULL){
 		return 1;
 	}
 
+	// Background color: cleared pixels, set pixels for inverted text
+	uint8_t erase = (print_form->config & LFC_INVERT) ? 0 : 1;
 
-	// Clip rectangle to screen boundaries
-	if(max_x > screen_width){
-		max_x=screen_width;
-		right_line = 0;
-	}
-	if(min_x < 0){
-		min_x=0;
-		left_line = 0;
-	}
+	LFC_TEXT  text;
+	LFC_GLYPH glyph;
+	LFC_RECT  rect;
+	uint8_t   next  = LFC_TEXT_END;
+	uint16_t  count = 0;
+	int16_t   px    = field->x;
+
+	_LFC_Text_Utf8(&text, str);
+
+	// Shape the new text, erase the old glyphs of the changed cells
+	while(count < field->max_cells){
+
+		next = _LFC_Next_Glyph(print_form, font_handle, &text, &glyph);
+		if(next != LFC_TEXT_GLYPH || glyph.type == LFC_GLYPH_NEWLINE){
+			break;
+		}
+
+		LFC_FIELD_CELL *cell = &field->cells[count];
+
+		if(count < field->cell_count){
+			if(cell->x == px && cell->glyph.type == glyph.type && cell->glyph.offset == glyph.offset && cell->glyph.advance == glyph.advance){
+				px += glyph.advance;
+				count++;
+				continue; // Same glyph at the same position
+			}
+
+			_LFC_Cell_Rect(cell, field->y, &rect);
+			LFC_Draw_Rect(print_form->display_context, &rect, LFC_FILL, erase);
+			_LFC_Rect_Union(&changed, &rect);
+		}
+
+		cell->glyph = glyph;
+		cell->x     = px;
 
+		_LFC_Cell_Rect(cell, field->y, &rect);
+		_LFC_Rect_Union(&changed, &rect);
 
-	if(max_y > screen_height){
-		max_y=screen_height;
-		top_line = 0;
+		px += glyph.advance;
+		count++;
 	}
-	if(min_y < 0){
-		min_y=0;
-		bottom_line = 0;
+
+	// Erase the cells after the end of the new text
+	for(uint16_t i=count; i<field->cell_count; i++){
+		_LFC_Cell_Rect(&field->cells[i], field->y, &rect);
+		LFC_Draw_Rect(print_form->display_context, &rect, LFC_FILL, erase);
+		_LFC_Rect_Union(&changed, &rect);
 	}
 
+	field->cell_count = count;
 
-	// Invert pixel
-	invert=invert?0:1;
+	// Draw the cells in the changed area
+	if(changed.width!=0){
+		for(uint16_t i=0; i<count; i++){
 
-	// Fill entire rectangle
-	if (fill==LFC_FILL) {
-		for (y = min_y; y <max_y; y++) {
-			for (x = min_x; x < max_x; x++) {
-				set_pixel_fnc(x, y, invert);
-			}
-		}
-	}
+			LFC_FIELD_CELL *cell = &field->cells[i];
+			_LFC_Cell_Rect(cell, field->y, &rect);
 
-	// Draw rectangle outline only
-	else {
-		// Draw left and right vertical lines
-		if (left_line) {
-			for (y = min_y; y < max_y; y++) {
-				set_pixel_fnc(min_x, y, invert);
+			if(rect.x >= changed.x + (int16_t)changed.width || rect.x + (int16_t)rect.width <= changed.x){
+				continue;
 			}
-		}
-		if (right_line) {
-			for (y = min_y; y < max_y; y++) {
-				set_pixel_fnc(max_x-1, y, invert);
+			if(rect.y >= changed.y + (int16_t)changed.height || rect.y + (int16_t)rect.height <= changed.y){
+				continue;
 			}
-		}
 
-		// Draw top and bottom horizontal lines
-		if (bottom_line) {
-			for (x = min_x; x < max_x; x++) {
-				set_pixel_fnc(x, min_y, invert);
-			}
-		}
-		if (top_line) {
-			for (x = min_x; x < max_x; x++) {
-				set_pixel_fnc(x, max_y-1, invert);
-			}
+			int16_t cx = cell->x;
+			int16_t cy = field->y;
+			_LFC_Draw_Shaped(print_form, font_handle, &cell->glyph, field->x, &cx, &cy, NULL);
 		}
 	}
 
-	return 0;
-}
+	if(dirty!=NULL){
+		*dirty = changed;
+	}
 
+	if(next == LFC_TEXT_ERROR){
+		return 1; // Conversion error
+	}
 
+	return 0;
+}
 
 
 
-uint8_t LFC_Draw_Rect(DISPLAY_CONTEXT * display_context, LFC_RECT * rect, uint8_t fill, uint8_t invert) {
+/*
+ * @brief Initialize a font source with its block cache in a caller-provided arena
+ *
+ * @param source: Font source structure
+ * @param read: Read callback
+ * @param context: Read callback context
+ * @param arena: Static buffer for blocks and the glyph buffer (4-byte aligned, e.g. uint32_t array)
+ * @param arena_size: Arena size in bytes, see LFC_SOURCE_ARENA_SIZE
+ * @param block_size: Bytes per block (at least 16, e.g. the flash page size)
+ * @param glyph_size: Glyph buffer bytes (5 + glyph height * width / 8 of the largest glyph, rounded up)
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error arena too small for one block, block size below 16
+ *
+ * The arena is split into block headers, block data and the glyph buffer.
+ */
 
-	LFC_RECT t_rect;
+uint8_t LFC_Source_Init(LFC_FONT_SOURCE * source, CB_Font_Read read, void * context, void * arena, uint32_t arena_size, uint16_t block_size, uint16_t glyph_size){
 
-	if(display_context==NULL || rect==NULL){
+	// Validate
+	if(source==NULL || read==NULL || arena==NULL){
 		return 1;
 	}
 
-	// Display context properties
-	uint16_t screen_width;
-	uint16_t screen_height;
-	uint8_t  screen_rotation  = display_context->rotation;
-
-	screen_width      = display_context->width;
-	screen_height     = display_context->height;
-
+	// Keep block data and the glyph buffer 4-byte aligned
+	uint32_t block_bytes = ((uint32_t)block_size + 3) & ~3;
+	uint32_t glyph_bytes = ((uint32_t)glyph_size + 3) & ~3;
 
-	// Change x to y axis and width to height
-	if(screen_rotation&0x01){
-		t_rect.x=rect->y;
-		t_rect.y=rect->x;
-		t_rect.width=rect->height;
-		t_rect.height=rect->width;
-	}else{
-		t_rect.x=rect->x;
-		t_rect.y=rect->y;
-		t_rect.width=rect->width;
-		t_rect.height=rect->height;
+	if(block_size<16 || arena_size<glyph_bytes){
+		return 2;
 	}
 
-
-	// reverse y axis : 0 degree and 270 degree
-	if((screen_rotation&0x03)==0x00 || (screen_rotation&0x03)==0x03){
-		t_rect.y=screen_height-(t_rect.y + t_rect.height);
+	uint32_t block_count = (arena_size - glyph_bytes) / (sizeof(LFC_SOURCE_BLOCK) + block_bytes);
+	if(block_count==0){
+		return 2;
 	}
-
-	// reverse x axis :180 degree and 270 degree
-	if((screen_rotation&0x03)==0x02 || (screen_rotation&0x03)==0x03){
-		t_rect.x=screen_width-(t_rect.x + t_rect.width);
+	if(block_count>255){
+		block_count=255;
 	}
 
+	source->read        = read;
+	source->context     = context;
+	source->blocks      = (LFC_SOURCE_BLOCK *)arena;
+	source->block_data  = (uint8_t *)arena + block_count * sizeof(LFC_SOURCE_BLOCK);
+	source->glyph       = source->block_data + block_count * block_bytes;
+	source->block_size  = block_size;
+	source->glyph_size  = glyph_size;
+	source->block_count = block_count;
+	source->generation  = 0;
 
-	return _LFC_Draw_Rect( display_context, &t_rect,  fill,  invert);
+	LFC_Source_Clear(source);
 
+	return 0;
 }
 
 
 
 /*
- * @brief Calculate string width without rendering
- *
- * @param print_form: Font properties
- * @param str: UTF-8 encoded input string
- *
+ * @brief Empty the block cache of a font source and reset the counters
  *
- * @return: Width of the string in pixel
+ * @param source: Font source structure
  *
+ * Must be called when the font in the external memory is changed. The new
+ * generation makes the glyph cache slots and font handles of the old font
+ * stale, the slots miss and the handles are re-parsed by _LFC_Form_Font.
  */
-uint16_t LFC_Str_Width(PRINT_FORM * print_form, const uint8_t *str) {
 
-	// Check null pointer
-	if(print_form==NULL || str==NULL){
-		return 0;
+void LFC_Source_Clear(LFC_FONT_SOURCE * source){
+
+	// Validate
+	if(source==NULL || source->blocks==NULL){
+		return;
 	}
 
-	LFC_RECT rect;
-	LFC_Str_Rect(print_form,str,0,0,&rect);
-	return rect.width;
+	for(uint8_t i=0;i<source->block_count;i++){
+		source->blocks[i].start = 0;
+		source->blocks[i].stamp = 0;
+	}
 
+	source->clock        = 0;
+	source->hits         = 0;
+	source->misses       = 0;
+	source->transactions = 0;
+	source->errors       = 0;
+	source->generation++;
 }
 
 
-/*
- * @brief Renders UTF-8 encoded string to display
- *
- * @param print_form: Font properties
- * @param str       : UTF-8 encoded input string
- * @param x         : Starting X coordinate
+
+/**
+ * @brief Calls the read callback, failed reads return zeros
  *
- * @return          : Final X coordinate after rendering complete string ( x + string width)
+ * @param source: Font source
+ * @param offset: Font offset
+ * @param buffer: Output buffer
+ * @param length: Byte count
  *
- * This is the main string rendering function that processes UTF-8 strings,
- * handles special characters (space, newline), converts to UTF-32,
- * looks up characters in font, and renders them sequentially.
+ * @return: 0: Success, 1: Read failed
  */
 
-int16_t LFC_Print(PRINT_FORM * print_form, const uint8_t * str, int16_t pos_x, int16_t pos_y){
-
-	// Check null pointer
-	if(print_form==NULL || str==NULL){
-		return 0;
-	}
-	if(print_form->display_context==NULL){
-		return 0;
-	}
-
-	pos_x+=print_form->padding;
-	pos_y+=print_form->padding;
-
-	// If set boundary box draw it and show string
-	if(print_form->config & LFC_BOUNDING_BOX){
-		LFC_RECT rect;
-		LFC_Str_Rect(print_form,str,pos_x,pos_y,&rect);
+static uint8_t _LFC_Source_Fetch(LFC_FONT_SOURCE * source, LFC_OFFSET offset, uint8_t * buffer, uint16_t length){
 
-		uint8_t fill;
-		if(print_form->config & LFC_INVERT){
-			fill=1;
-		}else{
-			fill=0;
-		}
-		LFC_Draw_Rect(print_form->display_context,&rect, fill,0);
-		return _LFC_Print(print_form,str, pos_x, pos_y)+2*print_form->padding;
+	source->transactions++;
 
+	if(source->read(source->context, offset, buffer, length)){
+		source->errors++;
+		memset(buffer, 0, length);
+		return 1;
 	}
 
-	// Show string Without boundary box
-	return _LFC_Print(print_form,str, pos_x, pos_y);
+	return 0;
 }
 
 
 
-
-/*
- * @brief Converts a UTF-32 character code to UTF-8 encoding
+/**
+ * @brief Finds the block of a font offset in the block cache, loads it on a miss
  *
- * @param utf32_c: UTF-32 character code to be converted
- * @param utf8_s: Pointer to buffer where UTF-8 encoded result will be stored (7 bytes)
- * @return: Number of bytes written to the output buffer (1-6 bytes)
- * @note: Handles Unicode character conversion from 32-bit format to variable-length UTF-8 encoding
- *        The output buffer must have at least 7 bytes of available space
+ * @param source: Font source
+ * @param start: Block start (multiple of the block size)
+ *
+ * @return: Block data
  */
-uint8_t LFC_Utf32_To_Utf8(uint32_t utf32_c, uint8_t* utf8_s) {
-	uint8_t us8_len;
-	uint8_t mask = 0xFF;
 
-	// Check null pointer
-	if(utf8_s==NULL){
-		return 0;
+static uint8_t * _LFC_Source_Block(LFC_FONT_SOURCE * source, LFC_OFFSET start){
+
+	LFC_SOURCE_BLOCK *lru = &source->blocks[0];
+	uint32_t block_bytes  = ((uint32_t)source->block_size + 3) & ~3;
+
+	source->clock++;
+
+	for(uint8_t i=0;i<source->block_count;i++){
+		LFC_SOURCE_BLOCK *block = &source->blocks[i];
+		if(block->stamp && block->start==start){
+			block->stamp = source->clock;
+			source->hits++;
+			return source->block_data + i * block_bytes;
+		}
+		if(block->stamp < lru->stamp){
+			lru = block;
+		}
 	}
 
-	// Zero-initialize buffer to ensure null-termination and prevent data leakage for any sequence length.
-    for (uint8_t i = 0; i < 7; i++) {
-        utf8_s[i] = 0;
-    }
+	// Load block to the least recently used block
+	uint8_t *data = source->block_data + (uint16_t)(lru - source->blocks) * block_bytes;
 
-    us8_len = 0;
+	source->misses++;
 
-    if (utf32_c < 0x80) {
-        utf8_s[us8_len++] = utf32_c;
-    }
-    else if (utf32_c < 0x800) {
-        mask = mask << 6;
-        utf8_s[us8_len++] = (((utf32_c) >> 6) & 0x1F) | mask;
-        utf8_s[us8_len++] = (utf32_c & 0x3F) | 0x80;
-    }
-    else if (utf32_c < 0x10000) {
-        mask = mask << 5;
-        utf8_s[us8_len++] = (((utf32_c) >> 12) & 0x0F) | mask;
-        utf8_s[us8_len++] = (((utf32_c) >>  6) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (utf32_c & 0x3F) | 0x80;
-    }
-    else if (utf32_c < 0x200000) {
-        mask = mask << 4;
-        utf8_s[us8_len++] = (((utf32_c) >> 18) & 0x07) | mask;
-        utf8_s[us8_len++] = (((utf32_c) >> 12) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (((utf32_c) >>  6) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (utf32_c & 0x3F) | 0x80;
-    }
-    else if(utf32_c < 0x4000000) {
-        mask = mask << 3;
-        utf8_s[us8_len++] = (((utf32_c) >> 24) & 0x03) | mask;
-        utf8_s[us8_len++] = (((utf32_c) >> 18) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (((utf32_c) >> 12) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (((utf32_c) >>  6) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (utf32_c& 0x3F) | 0x80;
-    }
-    else if (utf32_c < 0x80000000) {
-        mask = mask << 2;
-        utf8_s[us8_len++] = (((utf32_c) >> 30) & 0x01) | mask;
-        utf8_s[us8_len++] = (((utf32_c) >> 24) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (((utf32_c) >> 18) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (((utf32_c) >> 12) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (((utf32_c) >>  6) & 0x3F) | 0x80;
-        utf8_s[us8_len++] = (utf32_c & 0x3F) | 0x80;
-    }
+	// Failed reads are not kept, the block is read again on the next use
+	lru->start = start;
+	lru->stamp = _LFC_Source_Fetch(source, start, data, source->block_size) ? 0 : source->clock;
 
-    return us8_len;
+	return data;
 }
 
 
 
 /*
- * @brief Copy print form
+ * @brief Read font bytes through the block cache
  *
- * @param dest: Source print form structure
- * @param src : Destination print form structure
+ * @param source: Font source
+ * @param offset: Font offset
+ * @param length: Byte count, up to the block size (up to 12 if the bytes cross a block boundary)
  *
- * @return: 0:Success, 1:Error NULL pointer
+ * @return: Bytes, valid until the next read of the font source. NULL if length is too large.
  *
  */
 
-uint8_t LFC_Copy_Print_Form(PRINT_FORM * dest,const PRINT_FORM * src){
-	// Validate
-	if(dest==NULL || src==NULL){
-		return 1;
+const uint8_t * LFC_Source_Read(LFC_FONT_SOURCE * source, LFC_OFFSET offset, uint16_t length){
+
+	uint16_t   skip  = offset % source->block_size;
+	LFC_OFFSET start = offset - skip;
+
+	if(skip + length <= source->block_size){
+		return _LFC_Source_Block(source, start) + skip;
+	}
+
+	if(length > sizeof(source->bytes)){
+		return NULL;
 	}
 
-	// Copy fields
-	dest->display_context = src->display_context;
-	dest->font			  = src->font;
-	dest->spacing		  = src->spacing;
-	dest->config	      = src->config;
-	dest->padding	      = src->padding;
+	// Assemble bytes that cross a block boundary
+	uint16_t head = source->block_size - skip;
 
-	return 0;
+	memcpy(source->bytes, _LFC_Source_Block(source, start) + skip, head);
+	memcpy(source->bytes + head, _LFC_Source_Block(source, start + source->block_size), length - head);
+
+	return source->bytes;
 }
 
 
 
 /*
- * @brief Font validation function
+ * @brief Read a character header and its bitmap in one transaction
  *
- * @param font: C8 font array
+ * @param source: Font source
+ * @param offset: Character data offset
  *
- * @return: 0: Success
- * 			1: Error NULL pointer
- * 			2: Error signature, format error
- * 			3: Error structure length
- * 			4: Error offset address
+ * @return: Character header followed by the bitmap, valid until the next read of the font source.
+ *          NULL if the glyph does not fit in the glyph buffer or the read failed.
  *
+ * The header is usually in a cached block already (it was read for the
+ * glyph metrics). A glyph inside that block is returned from the block,
+ * others are read straight to the glyph buffer and are not kept in the
+ * block cache.
  */
-uint8_t LFC_Check_Font(const uint8_t * font){
-	uint16_t ind=0;
-	uint16_t chr_count=0;
-	if(font==NULL){
-		return 1; // Error NULL pointer
-	}
-
 
-	if(font[ind++]!=LFC_C8_FONT_SIGNATURE){
-		return 2; // Error signature, format error
-	}
-
-	if(font[ind++]!=LFC_C8_FONT_HEADER_LEN){
-		return 3; // Error structure length
-	}
-
-	ind++; // Font height
+const uint8_t * LFC_Source_Read_Glyph(LFC_FONT_SOURCE * source, LFC_OFFSET offset){
 
-	chr_count  = font[ind++];
-	chr_count |= ((uint16_t)font[ind++])<<8;
+	const uint8_t *header = LFC_Source_Read(source, offset, 5);
 
-	uint16_t cmap_start=ind;
-	uint16_t last_offset=cmap_start+chr_count*6; // Start of the character data
-	uint16_t chr_offset;
-	uint16_t offset_ind;
+	uint32_t size = 5 + (((uint32_t)header[0] * header[1] + 7) >> 3);
 
-	#define CHR_UTF32  4  // Character utf32 code (4 bytes)
-	#define CHR_OFFSET 2  // Character offset (2 bytes)
-
-	for(uint16_t i=0;i<chr_count;i++){
-		offset_ind=cmap_start+i*(CHR_UTF32+CHR_OFFSET) + CHR_UTF32; // Index of character offset data
-		chr_offset=font[offset_ind++]; 				    // Offset address LSB byte
-		chr_offset |=((uint16_t)font[offset_ind++])<<8; // Offset address MSB byte
+	if((offset % source->block_size) + size <= source->block_size){
+		return LFC_Source_Read(source, offset, size);
+	}
 
-		if(last_offset>chr_offset){
-			return 4; // Offset address error
-		}
+	if(size > source->glyph_size){
+		return NULL;
+	}
 
-		last_offset=chr_offset;
+	if(_LFC_Source_Fetch(source, offset, source->glyph, size)){
+		return NULL;
 	}
 
-	return 0; // Success
+	return source->glyph;
 }
 
 
 
 /*
- * @brief Renders UTF-32 code character
+ * @brief Initialize glyph cache in a caller-provided arena
  *
- * @param print_form: Font properties
- * @param str: UTF-32 character code
- * @param pos_x: Starting X coordinate
- * @param pos_y: Starting Y coordinate
+ * @param cache: Glyph cache structure
+ * @param arena: Static buffer for slots and bitmaps (4-byte aligned, e.g. uint32_t array)
+ * @param arena_size: Arena size in bytes, see LFC_CACHE_ARENA_SIZE
+ * @param bitmap_size: Bitmap bytes per slot (glyph height * ((glyph width + 7) / 8))
  *
- * @return: Final X coordinate after rendering complete string (next caret position)
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error arena too small for one slot
  *
+ * The arena is split into slot headers followed by slot bitmaps. Glyphs with
+ * a larger bitmap than bitmap_size are always read from the font.
  */
 
-int16_t LFC_Print_Utf32_Chr(PRINT_FORM *print_form,uint32_t chr,int16_t pos_x,int16_t pos_y){
+uint8_t LFC_Cache_Init(LFC_GLYPH_CACHE * cache, void * arena, uint16_t arena_size, uint16_t bitmap_size){
 
-	// Check null pointer
-	if(print_form==NULL){
-		return 0;
-	}
-	if(print_form->display_context==NULL){
-		return 0;
+	// Validate
+	if(cache==NULL || arena==NULL){
+		return 1;
 	}
 
-	uint8_t str[7];
+	// Keep slot bitmaps 4-byte aligned
+	bitmap_size = (bitmap_size + 3) & ~3;
 
-	// Convert utf-32 to utf-8
-	if(LFC_Utf32_To_Utf8(chr,str)==0){
-		return 0;
+	uint16_t slot_count = arena_size / (sizeof(LFC_CACHE_SLOT) + bitmap_size);
+	if(slot_count==0 || bitmap_size==0){
+		return 2;
+	}
+	if(slot_count>255){
+		slot_count=255;
 	}
 
-	return LFC_Print(print_form, str, pos_x, pos_y);
-}
+	cache->slots       = (LFC_CACHE_SLOT *)arena;
+	cache->bitmaps     = (uint8_t *)arena + slot_count * sizeof(LFC_CACHE_SLOT);
+	cache->bitmap_size = bitmap_size;
+	cache->slot_count  = slot_count;
 
+	LFC_Cache_Clear(cache);
 
+	return 0;
+}
 
 
 
-uint8_t LFC_Utf32_Char_Rect(PRINT_FORM *print_form, const uint32_t chr,int16_t x,int16_t y,LFC_RECT *rect){
-	// Check null pointer
-	if(print_form==NULL){
-		return 0;
-	}
-	if(print_form->display_context==NULL){
-		return 0;
-	}
+/*
+ * @brief Empty all cache slots and reset hit/miss counters
+ *
+ * @param cache: Glyph cache structure
+ *
+ * Must be called when a cached font array or font source is changed or replaced.
+ */
 
-	uint8_t str[7];
+void LFC_Cache_Clear(LFC_GLYPH_CACHE * cache){
 
-	// Convert utf-32 to utf-8
-	if(LFC_Utf32_To_Utf8(chr,str)==0){
-		return 0;
+	// Validate
+	if(cache==NULL || cache->slots==NULL){
+		return;
 	}
 
-	return LFC_Str_Rect(print_form, str, x, y,rect);
+	for(uint8_t i=0;i<cache->slot_count;i++){
+		cache->slots[i].font  = NULL;
+		cache->slots[i].stamp = 0;
+	}
 
+	cache->clock  = 0;
+	cache->hits   = 0;
+	cache->misses = 0;
 }
-
-
-
-
@@ -54,6 +54,9 @@ extern "C" {
 // Set pixel function prototype
 typedef void ( *CB_Set_Pixel)(uint16_t x,uint16_t y,uint8_t c);
 
+// Set span function prototype (horizontal run of len pixels starting at x,y)
+typedef void ( *CB_Set_Span)(uint16_t x,uint16_t y,uint16_t len,uint8_t c);
+
 
 // Define missing char width and height calculation
 #define MISSING_CHAR_SIZE(font_height) (((uint8_t)(font_height)*2)/3)
@@ -69,10 +72,57 @@ typedef void ( *CB_Set_Pixel)(uint16_t x,uint16_t y,uint8_t c);
 #define LFC_BOUNDING_BOX     0X10 // Show bounding box
 #define LFC_DEFAULT_CONFIG   0X00 // Default text configurations
 
+// Fixed advance modes (print form tabular field), need a font handle made by LFC_Load_Font
+#define LFC_PROPORTIONAL     0X00 // Glyphs have their own advance
+#define LFC_TABULAR_DIGITS   0X01 // Digits 0-9 have the advance of the widest digit (centered in the cell)
+#define LFC_MONOSPACE        0X02 // All glyphs have the advance of the widest glyph (centered in the cell)
+
+// Print position anchor (config bits), one horizontal and one vertical mode
+// Default: the text starts at x, the first baseline is at y
+#define LFC_ANCHOR_LEFT      0X00 // Lines start at x
+#define LFC_ANCHOR_CENTER    0X01 // Lines are centered on x
+#define LFC_ANCHOR_RIGHT     0X02 // Lines end at x
+#define LFC_ANCHOR_BASELINE  0X00 // First line baseline at y
+#define LFC_ANCHOR_TOP       0X04 // Bounding box top at y
+#define LFC_ANCHOR_BOTTOM    0X08 // Bounding box bottom at y
+#define LFC_ANCHOR_H_MASK    0X03
+#define LFC_ANCHOR_V_MASK    0X0C
+
 // C8 font signature
 #define LFC_C8_FONT_SIGNATURE  0XC8
 #define LFC_C8_FONT_HEADER_LEN 0X05
 
+// C9 font signature, range-compressed character map (same character data as C8)
+// Header: signature, header length, height, character count (16-bit), range count (16-bit)
+// Ranges: 4-byte first code point, 2-byte length, 2-byte first character (offset table index)
+// Offset table: 2-byte character data offset per character, then the character data
+#define LFC_C9_FONT_SIGNATURE  0XC9
+#define LFC_C9_FONT_HEADER_LEN 0X07
+#define LFC_C9_RANGE_SIZE      8
+
+// Optional C9 page index, header length 9: 2-byte page index offset from the font start (0: none)
+// Page index: first page (16-bit), page count (16-bit), block count (16-bit), 2-byte block per page (LFC_C9_NO_PAGE: empty)
+// Block: 256 code points of a page (code >> 8) as 8 groups of a 2-byte first character and a 32-bit bitmap
+#define LFC_C9_PAGED_HEADER_LEN 0X09
+#define LFC_C9_PAGE_HEADER_SIZE 6
+#define LFC_C9_PAGE_BLOCK_SIZE  48
+#define LFC_C9_NO_PAGE          0XFFFF
+
+// Wide C8 and C9 variants for fonts larger than 64 KB, same layout with 4-byte character data offsets
+// C8: 8-byte character map entries, C9: 4-byte offset table entries, header length 11 with a 4-byte page index offset
+#define LFC_C8W_FONT_SIGNATURE   0XD8
+#define LFC_C9W_FONT_SIGNATURE   0XD9
+#define LFC_C9W_PAGED_HEADER_LEN 0X0B
+
+
+// Character data offset in a font. Define LFC_OFFSET_16 to keep 16-bit offsets
+// on the smallest parts, wide fonts are rejected then.
+#ifdef LFC_OFFSET_16
+typedef uint16_t LFC_OFFSET;
+#else
+typedef uint32_t LFC_OFFSET;
+#endif
+
 
 // Use structure for computing string bounding box
 typedef struct{
@@ -84,23 +134,206 @@ typedef struct{
 
 
 // Display properties
+// Frame buffer layout (page-major): byte [(y/8)*width + x] holds 8 vertical
+// pixels of column x, bit 0 is the top row of the page (width*height/8 bytes)
 typedef struct{
 	uint16_t width;      // Screen width before rotation
 	uint16_t height;	 // Screen height before rotation
 	uint8_t  rotation;   // User-defined display rotation 0-3
 	CB_Set_Pixel set_pixel_func; // Set pixel function (defined in the display driver)
+	CB_Set_Span  set_span_func;  // Optional set span function, NULL: use set_pixel_func
+	uint8_t *    frame_buffer;   // Optional page-major frame buffer (SSD1306 layout), NULL: use callbacks
+	LFC_RECT *   clip_rect;      // Optional clip rectangle (rotated screen coordinates, as LFC_Draw_Rect), NULL: whole screen
+	LFC_RECT *   dirty_rect;     // Optional damage rectangle, grown by every draw (display coordinates, frame buffer rows), width 0: clean, NULL: not tracked
 }DISPLAY_CONTEXT;
 
 
+// Glyph cache slot, the slot bitmap follows the slot headers in the arena
+typedef struct{
+	const void * font;      // Font array (or font source) of the cached glyph, NULL: empty slot
+	uint32_t stamp;         // Last use time (LRU eviction)
+	LFC_OFFSET ind;         // Character data offset in the font
+	uint32_t generation;    // Font source generation of the cached glyph (font array: 0)
+	uint16_t stride;        // Bitmap bytes per row (rows are byte aligned)
+}LFC_CACHE_SLOT;
+
+
+// Glyph cache with fixed capacity, it lives in a caller-provided arena (no heap)
+// Can be shared by print forms with different fonts
+typedef struct{
+	LFC_CACHE_SLOT * slots; // Slot headers (start of the arena)
+	uint8_t * bitmaps;      // Slot bitmaps (after the slot headers)
+	uint16_t bitmap_size;   // Bitmap bytes per slot, larger glyphs are not cached
+	uint8_t  slot_count;    // Number of slots
+	uint32_t clock;         // Use counter for LRU stamps
+	uint32_t hits;          // Glyphs rendered from the cache
+	uint32_t misses;        // Glyphs read from the font (loaded or too large)
+}LFC_GLYPH_CACHE;
+
+
+// Arena bytes for slot_count glyphs of up to bitmap_size bitmap bytes
+#define LFC_CACHE_ARENA_SIZE(slot_count, bitmap_size) ((slot_count) * (sizeof(LFC_CACHE_SLOT) + (((bitmap_size) + 3) & ~3)))
+
+
+// Number characters: digits 0-9, hex digits A-F, minus, plus, decimal point, space
+#define LFC_NUMBER_CHARS 20
+
+
+// Font read callback: copy length bytes of the font at offset to buffer, return 0 on success.
+// Reads of a whole block may reach past the end of the font, those bytes are not used.
+typedef uint8_t ( *CB_Font_Read)(void * context, LFC_OFFSET offset, uint8_t * buffer, uint16_t length);
+
+
+// Block of a font source cache, the block data follows the block headers in the arena
+typedef struct{
+	LFC_OFFSET start;       // Font offset of the block (multiple of the block size)
+	uint32_t   stamp;       // Last use time (LRU eviction), 0: empty block
+}LFC_SOURCE_BLOCK;
+
+
+// Font in external memory (SPI NOR flash, SD card, file), read through a callback
+// The font tables are read through a fixed-size block cache, glyphs are read in
+// one transaction (character header and bitmap) to the glyph buffer.
+// The cache lives in a caller-provided arena (no heap).
+typedef struct{
+	CB_Font_Read read;         // Read callback
+	void *       context;      // Read callback context (driver handle, file)
+	LFC_SOURCE_BLOCK * blocks; // Block headers (start of the arena)
+	uint8_t *    block_data;   // Block data (after the block headers)
+	uint8_t *    glyph;        // Glyph buffer (after the block data)
+	uint16_t     block_size;   // Bytes per block
+	uint16_t     glyph_size;   // Glyph buffer bytes, larger glyphs are not drawn
+	uint8_t      block_count;  // Number of blocks
+	uint8_t      bytes[12];    // Values that cross a block boundary
+	uint32_t     clock;        // Use counter for LRU stamps
+	uint32_t     hits;         // Reads served from a cached block
+	uint32_t     misses;       // Blocks loaded
+	uint32_t     transactions; // Read callback calls
+	uint32_t     errors;       // Failed read callback calls (data read as zeros)
+	uint32_t     generation;   // Font generation, incremented by LFC_Source_Clear (font rewritten)
+}LFC_FONT_SOURCE;
+
+
+// Arena bytes for block_count blocks of block_size bytes and a glyph buffer of glyph_size bytes
+#define LFC_SOURCE_ARENA_SIZE(block_count, block_size, glyph_size) ((block_count) * (sizeof(LFC_SOURCE_BLOCK) + (((block_size) + 3) & ~3)) + (((glyph_size) + 3) & ~3))
+
+
+// Pre-parsed font, built once by LFC_Load_Font (or LFC_Load_Font_Source)
+// Tables are offsets from the font start, so fonts in memory and in a font source share them
+typedef struct{
+	const uint8_t * data;      // Font array (C8 or C9 format), NULL: font source
+	LFC_FONT_SOURCE * source;  // Font source, NULL: font array
+	uint32_t generation;       // Font source generation the tables were read from (font array: 0)
+	LFC_OFFSET cmap;           // Character map: C8: 4-byte UTF-32 code and 2-byte glyph offset per character, C9: code point ranges
+	LFC_OFFSET offsets;        // Character data offset of the first character, offset_stride bytes apart
+	LFC_OFFSET glyphs;         // Glyph data: character headers and bitmaps (after the character map)
+	uint16_t character_count;  // Number of characters in the font
+	uint16_t range_count;      // C9: code point ranges in the character map, C8: 0
+	uint8_t  offset_stride;    // Bytes between character data offsets (C8: 6, C9: 2, wide C8: 8, wide C9: 4)
+	uint8_t  offset_size;      // Bytes of a character data offset (2, wide fonts: 4)
+	uint8_t  format;           // LFC_C8_FONT_SIGNATURE or LFC_C9_FONT_SIGNATURE (also for the wide variants)
+	LFC_OFFSET page_table;     // C9 page index: 2-byte block per page, 0: no page index
+	LFC_OFFSET page_blocks;    // C9 page index: bitmap blocks (LFC_C9_PAGE_BLOCK_SIZE bytes each)
+	uint16_t first_page;       // Page (code >> 8) of the first page_table entry
+	uint16_t page_count;       // Number of page_table entries
+	uint8_t  height;           // Font height in pixels
+	uint8_t  missing_width;    // Width of the box drawn for missing characters (MISSING_CHAR_SIZE)
+	uint32_t direct_first;     // First code point of the longest contiguous code point range
+	uint16_t direct_start;     // Character map entry of direct_first
+	uint16_t direct_count;     // Range length, characters in it are found by direct index (0: binary search only)
+	LFC_OFFSET number_chars[LFC_NUMBER_CHARS]; // Character data offsets of the number characters (0: missing)
+	uint8_t  number_ready;     // 1: number_chars is set up by LFC_Load_Font, 0: numbers are looked up per character
+	uint8_t  digit_advance;    // Cell width of LFC_TABULAR_DIGITS: widest digit advance
+	uint8_t  max_advance;      // Cell width of LFC_MONOSPACE: widest glyph advance
+}LFC_FONT;
+
+
+// Shaped glyph types
+#define LFC_GLYPH_BITMAP  0 // Character of the font
+#define LFC_GLYPH_MISSING 1 // Character not in the font, drawn as a box
+#define LFC_GLYPH_NEWLINE 2 // Line break
+
+
+// Shaped glyph, built by LFC_Shape and drawn by LFC_Draw_Run
+typedef struct{
+	LFC_OFFSET offset;  // Character data offset in the font (LFC_GLYPH_BITMAP)
+	int16_t    advance; // Caret advance: left + max(width, advance) + spacing (if LFC_SPACING), missing: box size
+	uint8_t    width;   // Bitmap width, missing: box size
+	uint8_t    height;  // Bitmap height, missing: box size, newline: font height
+	int8_t     top;     // Bitmap top from origin
+	int8_t     left;    // Bitmap left from origin
+	uint8_t    type;    // LFC_GLYPH_BITMAP, LFC_GLYPH_MISSING or LFC_GLYPH_NEWLINE
+}LFC_GLYPH;
+
+
+// Text box line, offsets into the laid out text
+typedef struct{
+	uint16_t start;   // First byte of the line
+	uint16_t length;  // Bytes in the line (break space and newline are not included)
+	uint16_t width;   // Line width in pixels (used for alignment)
+}LFC_TEXT_LINE;
+
+
+// Line-break table of a text wrapped into a box, built once by LFC_Layout_Text
+typedef struct{
+	LFC_TEXT_LINE * lines; // Line table (caller-provided)
+	uint16_t max_lines;    // Size of the line table
+	uint16_t line_count;   // Lines of the text in the table
+	const uint8_t * text;  // Laid out UTF-8 text (not copied)
+	int16_t ascent;        // Highest glyph top, the first baseline is this far below the box top
+}LFC_TEXT_LAYOUT;
+
+
+// Text box alignment
+#define LFC_ALIGN_LEFT   0
+#define LFC_ALIGN_CENTER 1
+#define LFC_ALIGN_RIGHT  2
+
+
+// Text field cell, a glyph of the last drawn field text
+typedef struct{
+	LFC_GLYPH glyph;  // Shaped glyph
+	int16_t   x;      // Caret X coordinate of the glyph
+}LFC_FIELD_CELL;
+
+
+// Single-line text updated in place (clocks, counters), built by LFC_Field_Init
+typedef struct{
+	LFC_FIELD_CELL * cells; // Glyphs on the display (caller-provided)
+	uint16_t max_cells;     // Size of the cell table, longer text is cut
+	uint16_t cell_count;    // Glyphs of the last update
+	int16_t x;              // Text start X coordinate
+	int16_t y;              // Baseline Y coordinate
+}LFC_TEXT_FIELD;
+
+
+// Number print options
+#define LFC_NUMBER_ZERO_PAD 0X01 // Pad to the width with zeros after the sign (default: spaces before the sign)
+#define LFC_NUMBER_PLUS     0X02 // Show a plus sign for positive values (decimal numbers)
+
+// Maximum characters of a printed number (the width is limited to it)
+#define LFC_NUMBER_MAX 16
+
+
+// Glyphs kept on the stack by a bounding box print, they are shaped once for
+// measuring and drawing. Characters after them are shaped again after the box is drawn.
+#ifndef LFC_PRINT_CHUNK
+#define LFC_PRINT_CHUNK 16
+#endif
+
+
 // Print format structure
 // Contains font and print properties
 // Used by the print function
 typedef struct{
 	const uint8_t * font;  	// Font array (C8 format)
-	uint8_t config;		    // Properties, include: invert,spacing,boundary box
+	uint8_t config;		    // Properties, include: invert,spacing,boundary box,anchor
 	int8_t spacing;		    // Space between characters if set spacing from config
 	int8_t padding;	        // Boundary box padding size, all directions between text and box line
 	DISPLAY_CONTEXT *display_context;
+	LFC_GLYPH_CACHE *glyph_cache; // Optional glyph cache, NULL: glyphs are read from the font
+	const LFC_FONT *font_handle;  // Optional pre-parsed font (replaces font), NULL: font array is parsed on every call
+	uint8_t tabular;              // Fixed advance mode: LFC_PROPORTIONAL, LFC_TABULAR_DIGITS or LFC_MONOSPACE
 }PRINT_FORM;
 
 
@@ -116,6 +349,8 @@ typedef struct{
  *
  * @return: 0 on success, 1 on error
  *
+ * With anchor flags in the print form config the rectangle is placed as
+ * LFC_Print would place the text (x,y is the anchor point).
  */
 uint8_t LFC_Str_Rect(PRINT_FORM *print_form, const uint8_t * str,int16_t x,int16_t y,LFC_RECT *rect);
 
@@ -133,6 +368,10 @@ uint8_t LFC_Str_Rect(PRINT_FORM *print_form, const uint8_t * str,int16_t x,int16
  * This is the main string rendering function that processes UTF-8 strings,
  * handles special characters (space, newline), converts to UTF-32,
  * looks up characters in font, and renders them sequentially.
+ *
+ * Anchor flags in the print form config move the text relative to pos_x,pos_y
+ * (centered or right aligned lines, top or bottom of the bounding box). The
+ * origin is resolved from one measurement pass of the shaped glyphs.
  */
 
 int16_t LFC_Print(PRINT_FORM * print_form, const uint8_t * str, int16_t pos_x, int16_t pos_y);
@@ -149,6 +388,43 @@ int16_t LFC_Print(PRINT_FORM * print_form, const uint8_t * str, int16_t pos_x, i
 uint16_t LFC_Str_Width(PRINT_FORM * print_form, const uint8_t *str);
 
 
+/*
+ * @brief Length-bounded variants, the text needs no terminating zero
+ *
+ * @param str: UTF-8 encoded input text
+ * @param length: Bytes in the text (the text also ends at a zero byte)
+ *
+ * Same results as LFC_Print, LFC_Str_Rect and LFC_Str_Width of the text
+ * copied to a zero terminated buffer. No byte after str[length-1] is read,
+ * a multi-byte sequence cut by the end is a conversion error.
+ */
+
+int16_t LFC_Print_N(PRINT_FORM * print_form, const uint8_t * str, uint16_t length, int16_t pos_x, int16_t pos_y);
+
+uint8_t LFC_Str_Rect_N(PRINT_FORM * print_form, const uint8_t * str, uint16_t length, int16_t x, int16_t y, LFC_RECT *rect);
+
+uint16_t LFC_Str_Width_N(PRINT_FORM * print_form, const uint8_t *str, uint16_t length);
+
+
+/*
+ * @brief Initialize a display context
+ *
+ * @param display_context: Display properties
+ * @param width: Screen width before rotation
+ * @param height: Screen height before rotation
+ * @param rotation: Display rotation 0-3
+ * @param set_pixel_func: Set pixel function (defined in the display driver)
+ *
+ * @return: 0:Success, 1:Error NULL pointer
+ *
+ * Required before the optional fields are set. It clears every optional
+ * field (span callback, frame buffer, clip and damage rectangle), fields
+ * added in later versions are cleared too.
+ */
+
+uint8_t LFC_Display_Init(DISPLAY_CONTEXT * display_context, uint16_t width, uint16_t height, uint8_t rotation, CB_Set_Pixel set_pixel_func);
+
+
 /*
  * @brief Draws a rectangle on the display with optional filling
  *
@@ -157,13 +433,31 @@ uint16_t LFC_Str_Width(PRINT_FORM * print_form, const uint8_t *str);
  * @param fill: 1 to fill rectangle, 0 for outline only
  * @param invert: Invert drawing pixel
  *
- * @return: 0 if successful, 1 if rectangle is completely off-screen
+ * @return: 0 if successful, 1 if rectangle is completely off-screen (or outside the clip rectangle)
  *
  */
 
 uint8_t LFC_Draw_Rect(DISPLAY_CONTEXT * display_context, LFC_RECT * rect, uint8_t fill, uint8_t invert);
 
 
+/*
+ * @brief Initialize a print form
+ *
+ * @param print_form: Font properties
+ * @param font: Font array (C8, C9 or wide format)
+ * @param display_context: Display properties
+ *
+ * @return: 0:Success, 1:Error NULL pointer
+ *
+ * Required before the other fields are set. It disables all extra
+ * properties (LFC_DEFAULT_CONFIG, no spacing and padding) and clears the
+ * optional fields (glyph cache, pre-parsed font), fields added in later
+ * versions are cleared too.
+ */
+
+uint8_t LFC_Form_Init(PRINT_FORM * print_form, const uint8_t * font, DISPLAY_CONTEXT * display_context);
+
+
 /*
  * @brief Copy print form
  *
@@ -197,23 +491,418 @@ int16_t LFC_Print_Utf32_Chr(PRINT_FORM *print_form,uint32_t chr,int16_t pos_x,in
 uint8_t LFC_Utf32_Char_Rect(PRINT_FORM *print_form, const uint32_t chr,int16_t x,int16_t y,LFC_RECT *rect);
 
 
+/*
+ * @brief Renders UTF-32 code array
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-32 character codes
+ * @param length: Number of codes (the text also ends at a zero code)
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the codes (next caret position)
+ *
+ */
+
+int16_t LFC_Print_Utf32_Str(PRINT_FORM * print_form, const uint32_t * str, uint16_t length, int16_t pos_x, int16_t pos_y);
+
+
+/*
+ * @brief Calculates the bounding rectangle for a UTF-32 code array without rendering it
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-32 character codes
+ * @param length: Number of codes (the text also ends at a zero code)
+ * @param x: Starting X coordinate
+ * @param y: Starting Y coordinate
+ * @param rect: Output rectangle structure
+ *
+ * @return: 0 on success, 1 on error
+ *
+ */
+
+uint8_t LFC_Str_Rect_Utf32(PRINT_FORM * print_form, const uint32_t * str, uint16_t length, int16_t x, int16_t y, LFC_RECT *rect);
+
+
+/*
+ * @brief Converts a UTF-32 character code to UTF-8 encoding
+ *
+ * @param utf32_c: UTF-32 character code
+ * @param utf8_s: Output buffer (7 bytes, zero terminated)
+ *
+ * @return: Number of UTF-8 bytes, 0 on error
+ *
+ */
+
+uint8_t LFC_Utf32_To_Utf8(uint32_t utf32_c, uint8_t* utf8_s);
+
+
+/*
+ * @brief Converts one UTF-8 character to UTF-32 code
+ *
+ * @param str: UTF-8 encoded input string
+ * @param u32_code: Output 4-byte array (little endian code point)
+ *
+ * @return: UTF-8 byte length, 0 on error (invalid, overlong or surrogate sequence)
+ *
+ */
+
+uint8_t LFC_Utf8_To_Utf32(const uint8_t * str, uint8_t * u32_code);
+
+
+/*
+ * @brief Shapes UTF-8 string into a glyph run
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-8 encoded input string
+ * @param glyphs: Output glyph array (caller-owned)
+ * @param max_glyphs: Size of the glyph array
+ *
+ * @return: Number of glyphs written, shaping stops at the end of the array
+ *          or at an invalid UTF-8 sequence
+ *
+ * Characters are decoded and looked up once, the run is drawn by LFC_Draw_Run
+ * with the same print form font, spacing config and display orientation.
+ */
+
+uint16_t LFC_Shape(PRINT_FORM * print_form, const uint8_t * str, LFC_GLYPH * glyphs, uint16_t max_glyphs);
+
+
+/*
+ * @brief Shapes UTF-32 code array into a glyph run
+ *
+ * @param print_form: Font properties
+ * @param str: UTF-32 character codes
+ * @param length: Number of codes (the text also ends at a zero code)
+ * @param glyphs: Output glyph array (caller-owned)
+ * @param max_glyphs: Size of the glyph array
+ *
+ * @return: Number of glyphs written, shaping stops at the end of the array
+ *          or at an invalid UTF-32 code
+ *
+ * Same run as LFC_Shape of the UTF-8 encoded text without the conversion.
+ */
+
+uint16_t LFC_Shape_Utf32(PRINT_FORM * print_form, const uint32_t * str, uint16_t length, LFC_GLYPH * glyphs, uint16_t max_glyphs);
+
+
+/*
+ * @brief Calculates the bounding rectangle for a glyph run without rendering it
+ *
+ * @param print_form: Font properties
+ * @param glyphs: Glyph run made by LFC_Shape
+ * @param count: Number of glyphs
+ * @param x: Starting X coordinate
+ * @param y: Starting Y coordinate
+ * @param rect: Output rectangle structure
+ *
+ * @return: 0 on success, 1 on error
+ *
+ */
+
+uint8_t LFC_Run_Rect(PRINT_FORM * print_form, const LFC_GLYPH * glyphs, uint16_t count, int16_t x, int16_t y, LFC_RECT *rect);
+
+
+/*
+ * @brief Renders a glyph run to display
+ *
+ * @param print_form: Font properties
+ * @param glyphs: Glyph run made by LFC_Shape
+ * @param count: Number of glyphs
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the run (next caret position)
+ *
+ * Same output as LFC_Print of the shaped string, without UTF-8 decoding
+ * and character map lookups.
+ */
+
+int16_t LFC_Draw_Run(PRINT_FORM * print_form, const LFC_GLYPH * glyphs, uint16_t count, int16_t pos_x, int16_t pos_y);
+
+
+/*
+ * @brief Wraps UTF-8 text into lines of a text box
+ *
+ * @param print_form: Font properties
+ * @param layout: Text box layout, lines and max_lines are set by the caller
+ * @param str: UTF-8 encoded input text (not copied, kept until the layout is drawn)
+ * @param length: Bytes in the text (the text also ends at a zero byte)
+ * @param width: Box width in pixels
+ *
+ * @return: Number of lines
+ *
+ */
+
+uint16_t LFC_Layout_Text(PRINT_FORM * print_form, LFC_TEXT_LAYOUT * layout, const uint8_t * str, uint16_t length, uint16_t width);
+
+
+/*
+ * @brief Draws the lines of a text layout in a box
+ *
+ * @param print_form: Font properties (the font of the layout)
+ * @param layout: Text box layout made by LFC_Layout_Text
+ * @param box: Text box
+ * @param first_line: First line drawn at the top of the box (scroll position)
+ * @param align: LFC_ALIGN_LEFT, LFC_ALIGN_CENTER or LFC_ALIGN_RIGHT
+ *
+ * @return: Number of lines drawn (fully or partly visible)
+ *
+ */
+
+uint16_t LFC_Draw_Text_Box(PRINT_FORM * print_form, const LFC_TEXT_LAYOUT * layout, const LFC_RECT * box, uint16_t first_line, uint8_t align);
+
+
+/*
+ * @brief Renders a decimal integer without formatting it to a string
+ *
+ * @param print_form: Font properties
+ * @param value: Integer value
+ * @param width: Minimum characters (sign included), padded with spaces or zeros
+ * @param options: LFC_NUMBER_ZERO_PAD, LFC_NUMBER_PLUS
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the number (next caret position)
+ *
+ */
+
+int16_t LFC_Print_Int(PRINT_FORM * print_form, int32_t value, uint8_t width, uint8_t options, int16_t pos_x, int16_t pos_y);
+
+
+/*
+ * @brief Renders a fixed-point decimal number without formatting it to a string
+ *
+ * @param print_form: Font properties
+ * @param value: Value scaled by 10^decimals (1234 with 2 decimals: 12.34)
+ * @param decimals: Digits after the decimal point (0-9)
+ * @param width: Minimum characters (sign and point included), padded with spaces or zeros
+ * @param options: LFC_NUMBER_ZERO_PAD, LFC_NUMBER_PLUS
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the number (next caret position)
+ *
+ */
+
+int16_t LFC_Print_Fixed(PRINT_FORM * print_form, int32_t value, uint8_t decimals, uint8_t width, uint8_t options, int16_t pos_x, int16_t pos_y);
+
+
+/*
+ * @brief Renders an unsigned hexadecimal number (upper case digits, no prefix)
+ *
+ * @param print_form: Font properties
+ * @param value: Value
+ * @param width: Minimum digits, padded with spaces or zeros
+ * @param options: LFC_NUMBER_ZERO_PAD
+ * @param pos_x: Starting X coordinate
+ * @param pos_y: Starting Y coordinate
+ *
+ * @return: Final X coordinate after rendering the number (next caret position)
+ *
+ */
+
+int16_t LFC_Print_Hex(PRINT_FORM * print_form, uint32_t value, uint8_t width, uint8_t options, int16_t pos_x, int16_t pos_y);
+
+
+/*
+ * @brief Initialize a text field
+ *
+ * @param field: Text field structure
+ * @param cells: Cell table (caller-provided), one cell per glyph
+ * @param max_cells: Size of the cell table
+ * @param x: Text start X coordinate
+ * @param y: Baseline Y coordinate
+ *
+ */
+
+void LFC_Field_Init(LFC_TEXT_FIELD * field, LFC_FIELD_CELL * cells, uint16_t max_cells, int16_t x, int16_t y);
+
+
+/*
+ * @brief Updates the text of a text field, redraws only the changed glyphs
+ *
+ * @param print_form: Font properties (the same font and spacing for every update)
+ * @param field: Text field made by LFC_Field_Init
+ * @param str: UTF-8 encoded new text (single line)
+ * @param dirty: Output changed area (width 0: nothing changed), can be NULL
+ *
+ * @return: 0 on success, 1 on error
+ *
+ */
+
+uint8_t LFC_Field_Update(PRINT_FORM * print_form, LFC_TEXT_FIELD * field, const uint8_t * str, LFC_RECT * dirty);
+
+
 
 /*
  * @brief Font validation function
  *
- * @param font: C8 font array
+ * @param font: C8 or C9 font array
  *
  * @return: 0: Success
  * 			1: Error NULL pointer
  * 			2: Error signature, format error
  * 			3: Error structure length
  * 			4: Error offset address
+ * 			5: Error page index (C9)
  *
  */
 
 uint8_t  LFC_Check_Font(const uint8_t * font);
 
 
+/*
+ * @brief Font validation function for a font of known size
+ *
+ * @param font: C8 or C9 font array
+ * @param size: Font size in bytes
+ *
+ * @return: Same codes as LFC_Check_Font
+ *
+ * Also checks that no table or glyph reaches past size bytes
+ * (fonts loaded at run time).
+ */
+
+uint8_t  LFC_Check_Font_Size(const uint8_t * font, uint32_t size);
+
+
+/*
+ * @brief Validate a font and build its font handle
+ *
+ * @param font_handle: Output font handle
+ * @param font: C8 or C9 font array
+ *
+ * @return: 0: Success, otherwise LFC_Check_Font error code
+ *
+ */
+
+uint8_t LFC_Load_Font(LFC_FONT * font_handle, const uint8_t * font);
+
+
+/*
+ * @brief Initialize a font source with its block cache in a caller-provided arena
+ *
+ * @param source: Font source structure
+ * @param read: Read callback
+ * @param context: Read callback context
+ * @param arena: Static buffer for blocks and the glyph buffer (4-byte aligned, e.g. uint32_t array)
+ * @param arena_size: Arena size in bytes, see LFC_SOURCE_ARENA_SIZE
+ * @param block_size: Bytes per block (at least 16, e.g. the flash page size)
+ * @param glyph_size: Glyph buffer bytes (5 + glyph height * width / 8 of the largest glyph, rounded up)
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error arena too small for one block, block size below 16
+ *
+ */
+
+uint8_t LFC_Source_Init(LFC_FONT_SOURCE * source, CB_Font_Read read, void * context, void * arena, uint32_t arena_size, uint16_t block_size, uint16_t glyph_size);
+
+
+/*
+ * @brief Empty the block cache of a font source and reset the counters
+ *
+ * @param source: Font source structure
+ *
+ * Must be called when the font in the external memory is rewritten. The
+ * font generation is incremented: glyph cache slots of the old font are
+ * not used any more, and a font handle built before is re-parsed from the
+ * header on every call (no direct index, number or tabular tables) until
+ * LFC_Load_Font_Source is called again.
+ */
+
+void LFC_Source_Clear(LFC_FONT_SOURCE * source);
+
+
+/*
+ * @brief Read font bytes through the block cache
+ *
+ * @param source: Font source
+ * @param offset: Font offset
+ * @param length: Byte count, up to the block size (up to 12 if the bytes cross a block boundary)
+ *
+ * @return: Bytes, valid until the next read of the font source. NULL if length is too large.
+ *
+ */
+
+const uint8_t * LFC_Source_Read(LFC_FONT_SOURCE * source, LFC_OFFSET offset, uint16_t length);
+
+
+/*
+ * @brief Read a character header and its bitmap in one transaction
+ *
+ * @param source: Font source
+ * @param offset: Character data offset
+ *
+ * @return: Character header followed by the bitmap, valid until the next read of the font source.
+ *          NULL if the glyph does not fit in the glyph buffer or the read failed.
+ *
+ */
+
+const uint8_t * LFC_Source_Read_Glyph(LFC_FONT_SOURCE * source, LFC_OFFSET offset);
+
+
+/*
+ * @brief Build a font handle for a font in a font source
+ *
+ * @param font_handle: Output font handle
+ * @param source: Initialized font source
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error signature, format error
+ * 			3: Error structure length
+ *
+ * Only the header is validated, check the font with LFC_Check_Font_Source
+ * once after it is written to the external memory.
+ */
+
+uint8_t LFC_Load_Font_Source(LFC_FONT * font_handle, LFC_FONT_SOURCE * source);
+
+
+/*
+ * @brief Font validation through a font source
+ *
+ * @param source: Initialized font source
+ * @param size: Font size in bytes
+ *
+ * @return: Same codes as LFC_Check_Font_Size, 3 also if a read failed
+ *
+ * Reads the whole font tables and every glyph header, call it once after
+ * the font is written (not before every LFC_Load_Font_Source).
+ */
+
+uint8_t LFC_Check_Font_Source(LFC_FONT_SOURCE * source, uint32_t size);
+
+
+/*
+ * @brief Initialize glyph cache in a caller-provided arena
+ *
+ * @param cache: Glyph cache structure
+ * @param arena: Static buffer for slots and bitmaps (4-byte aligned, e.g. uint32_t array)
+ * @param arena_size: Arena size in bytes, see LFC_CACHE_ARENA_SIZE
+ * @param bitmap_size: Bitmap bytes per slot (glyph height * ((glyph width + 7) / 8))
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error arena too small for one slot
+ *
+ */
+
+uint8_t LFC_Cache_Init(LFC_GLYPH_CACHE * cache, void * arena, uint16_t arena_size, uint16_t bitmap_size);
+
+
+/*
+ * @brief Empty all cache slots and reset hit/miss counters
+ *
+ * @param cache: Glyph cache structure
+ *
+ */
+
+void LFC_Cache_Clear(LFC_GLYPH_CACHE * cache);
+
+
 #ifdef __cplusplus
 	}//extern "C"
 #endif
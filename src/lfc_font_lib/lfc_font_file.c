@@ -0,0 +1,169 @@
+/*
+ *
+ *  File:     lfc_font_file.c
+ *  Info:     File font source for the LFC font library (host builds)
+ *
+ */
+
+
+
+
+/*
+ ******************************************************************************
+
+ The MIT License (MIT)
+ Copyright (c) 2026 M.Cetin Atila
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+ ******************************************************************************
+ */
+
+
+
+
+// Host builds only, the MCU build reads fonts from flash with its own read callback
+#if defined(__unix__) || defined(__APPLE__) || defined(_WIN32)
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "lfc_font_file.h"
+
+
+
+
+/**
+ * @brief Font source read callback of a font file
+ *
+ * @param context: Font file structure
+ * @param offset: Font offset
+ * @param buffer: Output buffer
+ * @param length: Byte count
+ *
+ * @return: 0: Success, 1: Error seek or read
+ *
+ * Block reads may reach past the end of the file, the missing bytes are
+ * returned as zeros.
+ */
+
+static uint8_t _LFC_File_Read(void * context, LFC_OFFSET offset, uint8_t * buffer, uint16_t length){
+
+	LFC_FONT_FILE *font_file = (LFC_FONT_FILE *)context;
+
+	if(offset >= font_file->size){
+		return 1;
+	}
+
+	if(fseek(font_file->file, (long)offset, SEEK_SET)){
+		return 1;
+	}
+
+	size_t count = fread(buffer, 1, length, font_file->file);
+
+	if(count < length){
+		if(ferror(font_file->file)){
+			clearerr(font_file->file);
+			return 1;
+		}
+		memset(buffer + count, 0, length - count);
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * @brief Open a font file as a font source
+ *
+ * @param source: Font source structure
+ * @param font_file: Font file structure (read callback context)
+ * @param path: Font file path (C8 or C9 font bytes, as in the font arrays)
+ * @param arena: Static buffer for blocks and the glyph buffer, see LFC_Source_Init
+ * @param arena_size: Arena size in bytes, see LFC_SOURCE_ARENA_SIZE
+ * @param block_size: Bytes per block
+ * @param glyph_size: Glyph buffer bytes
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error arena too small for one block, block size below 16
+ * 			3: Error opening the file
+ *
+ */
+
+uint8_t LFC_File_Source_Open(LFC_FONT_SOURCE * source, LFC_FONT_FILE * font_file, const char * path, void * arena, uint32_t arena_size, uint16_t block_size, uint16_t glyph_size){
+
+	// Validate
+	if(source==NULL || font_file==NULL || path==NULL){
+		return 1;
+	}
+
+	uint8_t result = LFC_Source_Init(source, _LFC_File_Read, font_file, arena, arena_size, block_size, glyph_size);
+	if(result){
+		return result;
+	}
+
+	font_file->file = fopen(path, "rb");
+	if(font_file->file==NULL){
+		return 3;
+	}
+
+	// Unbuffered: every read callback call is one read of the file
+	setvbuf(font_file->file, NULL, _IONBF, 0);
+
+	long size = -1;
+	if(fseek(font_file->file, 0, SEEK_END)==0){
+		size = ftell(font_file->file);
+	}
+
+	if(size < 0){
+		LFC_File_Source_Close(font_file);
+		return 3;
+	}
+
+	font_file->size = (uint32_t)size;
+
+	return 0;
+}
+
+
+
+/*
+ * @brief Close the font file of a font source
+ *
+ * @param font_file: Font file structure
+ *
+ */
+
+void LFC_File_Source_Close(LFC_FONT_FILE * font_file){
+
+	// Validate
+	if(font_file==NULL || font_file->file==NULL){
+		return;
+	}
+
+	fclose(font_file->file);
+	font_file->file = NULL;
+	font_file->size = 0;
+}
+
+
+#endif
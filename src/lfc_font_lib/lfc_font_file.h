@@ -0,0 +1,99 @@
+/*
+ *
+ *  File:     lfc_font_file.h
+ *  Info:     File font source for the LFC font library (host builds)
+ *
+ */
+
+
+
+
+/*
+ ******************************************************************************
+
+ The MIT License (MIT)
+ Copyright (c) 2026 M.Cetin Atila
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+ ******************************************************************************
+ */
+
+
+
+
+#ifndef LFC_FONT_FILE_H
+#define LFC_FONT_FILE_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include "lfc_font.h"
+
+
+// Font file of a font source
+typedef struct{
+	FILE *   file;  // Open font file (unbuffered, the block cache is the buffer)
+	uint32_t size;  // File size in bytes
+}LFC_FONT_FILE;
+
+
+/*
+ * @brief Open a font file as a font source
+ *
+ * @param source: Font source structure
+ * @param font_file: Font file structure (read callback context)
+ * @param path: Font file path (C8 or C9 font bytes, as in the font arrays)
+ * @param arena: Static buffer for blocks and the glyph buffer, see LFC_Source_Init
+ * @param arena_size: Arena size in bytes, see LFC_SOURCE_ARENA_SIZE
+ * @param block_size: Bytes per block
+ * @param glyph_size: Glyph buffer bytes
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error arena too small for one block, block size below 16
+ * 			3: Error opening the file
+ *
+ */
+
+uint8_t LFC_File_Source_Open(LFC_FONT_SOURCE * source, LFC_FONT_FILE * font_file, const char * path, void * arena, uint32_t arena_size, uint16_t block_size, uint16_t glyph_size);
+
+
+/*
+ * @brief Close the font file of a font source
+ *
+ * @param font_file: Font file structure
+ *
+ */
+
+void LFC_File_Source_Close(LFC_FONT_FILE * font_file);
+
+
+#ifdef __cplusplus
+	}//extern "C"
+#endif
+
+
+
+#endif /* LFC_FONT_FILE_H */
@@ -0,0 +1,472 @@
+/*
+ *
+ *  File:     lfc_font_pack.c
+ *  Info:     Font pack files for the LFC font library (host builds)
+ *
+ */
+
+
+
+
+/*
+ ******************************************************************************
+
+ The MIT License (MIT)
+ Copyright (c) 2026 M.Cetin Atila
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+ ******************************************************************************
+ */
+
+
+
+// Host builds only, font packs are memory-mapped files
+#if defined(__unix__) || defined(__APPLE__)
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "lfc_font_pack.h"
+
+
+
+
+// CRC-32 (IEEE 802.3, reflected 0xEDB88320) nibble table
+static const uint32_t _lfc_crc32_table[16] = {
+	0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+	0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+
+
+/**
+ * @brief Continues a CRC-32 over a buffer
+ *
+ * @param crc: CRC of the previous bytes (0 for the first buffer)
+ * @param data: Bytes
+ * @param length: Byte count
+ *
+ * @return: CRC-32 of the previous bytes and data
+ */
+
+static uint32_t _LFC_Crc32(uint32_t crc, const uint8_t * data, size_t length){
+
+	crc = ~crc;
+
+	for(size_t i=0;i<length;i++){
+		crc ^= data[i];
+		crc = (crc >> 4) ^ _lfc_crc32_table[crc & 0x0F];
+		crc = (crc >> 4) ^ _lfc_crc32_table[crc & 0x0F];
+	}
+
+	return ~crc;
+}
+
+
+
+/**
+ * @brief Reads a little endian 16-bit value
+ */
+
+static uint16_t _LFC_Get16(const uint8_t * p){
+	return p[0] | ((uint16_t)p[1] << 8);
+}
+
+
+
+/**
+ * @brief Reads a little endian 32-bit value
+ */
+
+static uint32_t _LFC_Get32(const uint8_t * p){
+	return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+
+
+/**
+ * @brief Writes a little endian 16-bit value
+ */
+
+static void _LFC_Put16(uint8_t * p, uint16_t value){
+	p[0] = value;
+	p[1] = value >> 8;
+}
+
+
+
+/**
+ * @brief Writes a little endian 32-bit value
+ */
+
+static void _LFC_Put32(uint8_t * p, uint32_t value){
+	p[0] = value;
+	p[1] = value >> 8;
+	p[2] = value >> 16;
+	p[3] = value >> 24;
+}
+
+
+
+/**
+ * @brief Checks a font name (NUL terminated inside the name field, not empty)
+ *
+ * @param name: Name field of a directory entry
+ *
+ * @return: 1: Valid name, 0: Invalid name
+ */
+
+static uint8_t _LFC_Pack_Name_Valid(const uint8_t * name){
+	return name[0]!=0 && memchr(name, 0, LFC_PACK_NAME_SIZE)!=NULL;
+}
+
+
+
+/**
+ * @brief Validates the header, the directory and every font of a mapped pack
+ *
+ * @param map: Pack bytes
+ * @param size: Pack size in bytes
+ *
+ * @return: Same codes as LFC_Pack_Open
+ */
+
+static uint8_t _LFC_Pack_Check(const uint8_t * map, size_t size){
+
+	if(size<LFC_PACK_HEADER_SIZE || memcmp(map, LFC_PACK_MAGIC, 4)){
+		return 3; // Error header
+	}
+
+	uint16_t version    = _LFC_Get16(&map[4]);
+	uint16_t font_count = _LFC_Get16(&map[6]);
+	uint16_t alignment  = _LFC_Get16(&map[8]);
+	uint16_t entry_size = _LFC_Get16(&map[10]);
+
+	if(version!=LFC_PACK_VERSION || entry_size!=LFC_PACK_ENTRY_SIZE || alignment<4 || (alignment & (alignment - 1))){
+		return 3; // Error header
+	}
+
+	size_t directory_end = LFC_PACK_HEADER_SIZE + (size_t)font_count * LFC_PACK_ENTRY_SIZE;
+	if(directory_end>size){
+		return 3; // Error header
+	}
+
+	// Header and directory checksum
+	uint32_t crc = _LFC_Crc32(0, map, 12);
+	crc = _LFC_Crc32(crc, &map[LFC_PACK_HEADER_SIZE], directory_end - LFC_PACK_HEADER_SIZE);
+	if(crc!=_LFC_Get32(&map[12])){
+		return 4; // Error directory checksum
+	}
+
+	for(uint16_t i=0;i<font_count;i++){
+		const uint8_t *entry = &map[LFC_PACK_HEADER_SIZE + (size_t)i * LFC_PACK_ENTRY_SIZE];
+
+		uint32_t offset = _LFC_Get32(&entry[32]);
+		uint32_t length = _LFC_Get32(&entry[36]);
+
+		if(!_LFC_Pack_Name_Valid(entry) || (offset & (alignment - 1)) || offset<directory_end || offset>size || length>size-offset){
+			return 5; // Error font entry
+		}
+
+		// Names are unique, fonts are looked up by name
+		for(uint16_t k=0;k<i;k++){
+			if(strcmp((const char *)entry, (const char *)&map[LFC_PACK_HEADER_SIZE + (size_t)k * LFC_PACK_ENTRY_SIZE])==0){
+				return 5; // Error duplicate name
+			}
+		}
+
+		if(_LFC_Crc32(0, &map[offset], length)!=_LFC_Get32(&entry[40])){
+			return 6; // Error font checksum
+		}
+
+		if(LFC_Check_Font_Size(&map[offset], length)){
+			return 7; // Error font
+		}
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * @brief Map a font pack read-only and validate it
+ *
+ * @param pack: Font pack structure
+ * @param path: Font pack file path
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error opening or mapping the file
+ * 			3: Error header (magic, version, alignment, entry size)
+ * 			4: Error directory checksum
+ * 			5: Error font entry (name, bounds, alignment, duplicate name)
+ * 			6: Error font checksum
+ * 			7: Error font (LFC_Check_Font_Size)
+ *
+ * The mapping is shared, processes that open the same pack share one copy
+ * in the page cache.
+ */
+
+uint8_t LFC_Pack_Open(LFC_FONT_PACK * pack, const char * path){
+
+	// Validate
+	if(pack==NULL || path==NULL){
+		return 1;
+	}
+
+	pack->map        = NULL;
+	pack->size       = 0;
+	pack->directory  = NULL;
+	pack->font_count = 0;
+
+	int fd = open(path, O_RDONLY);
+	if(fd<0){
+		return 2;
+	}
+
+	struct stat st;
+	if(fstat(fd, &st)){
+		close(fd);
+		return 2;
+	}
+	if(st.st_size<LFC_PACK_HEADER_SIZE){
+		close(fd);
+		return 3; // Error header
+	}
+
+	void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd); // The mapping keeps the file
+
+	if(map==MAP_FAILED){
+		return 2;
+	}
+
+	uint8_t result = _LFC_Pack_Check((const uint8_t *)map, (size_t)st.st_size);
+	if(result){
+		munmap(map, (size_t)st.st_size);
+		return result;
+	}
+
+	pack->map        = (const uint8_t *)map;
+	pack->size       = (size_t)st.st_size;
+	pack->directory  = pack->map + LFC_PACK_HEADER_SIZE;
+	pack->font_count = _LFC_Get16(&pack->map[6]);
+
+	return 0;
+}
+
+
+
+/*
+ * @brief Unmap a font pack
+ *
+ * @param pack: Font pack structure
+ *
+ */
+
+void LFC_Pack_Close(LFC_FONT_PACK * pack){
+
+	// Validate
+	if(pack==NULL || pack->map==NULL){
+		return;
+	}
+
+	munmap((void *)pack->map, pack->size);
+
+	pack->map        = NULL;
+	pack->size       = 0;
+	pack->directory  = NULL;
+	pack->font_count = 0;
+}
+
+
+
+/*
+ * @brief Returns the name of a font in the pack
+ *
+ * @param pack: Open font pack
+ * @param index: Font index (0 to font_count - 1)
+ *
+ * @return: Font name, NULL if index is out of the pack
+ */
+
+const char * LFC_Pack_Font_Name(const LFC_FONT_PACK * pack, uint16_t index){
+
+	// Validate
+	if(pack==NULL || pack->map==NULL || index>=pack->font_count){
+		return NULL;
+	}
+
+	return (const char *)&pack->directory[(size_t)index * LFC_PACK_ENTRY_SIZE];
+}
+
+
+
+/*
+ * @brief Build the font handle of a named font in the pack
+ *
+ * @param pack: Open font pack
+ * @param name: Font name
+ * @param font_handle: Output font handle (points into the mapping)
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error font not found
+ * 			3: Error LFC_Load_Font
+ *
+ */
+
+uint8_t LFC_Pack_Load_Font(const LFC_FONT_PACK * pack, const char * name, LFC_FONT * font_handle){
+
+	// Validate
+	if(pack==NULL || pack->map==NULL || name==NULL || font_handle==NULL){
+		return 1;
+	}
+
+	for(uint16_t i=0;i<pack->font_count;i++){
+		const uint8_t *entry = &pack->directory[(size_t)i * LFC_PACK_ENTRY_SIZE];
+
+		if(strcmp((const char *)entry, name)==0){
+			// The font was checked by LFC_Pack_Open, the handle points into the mapping
+			return LFC_Load_Font(font_handle, &pack->map[_LFC_Get32(&entry[32])]) ? 3 : 0;
+		}
+	}
+
+	return 2; // Font not found
+}
+
+
+
+/*
+ * @brief Write a font pack file
+ *
+ * @param path: Font pack file path
+ * @param names: Font names (up to 31 characters)
+ * @param fonts: Font arrays
+ * @param sizes: Font sizes in bytes
+ * @param count: Number of fonts
+ * @param alignment: Font alignment (power of two, at least 4), e.g. LFC_PACK_ALIGNMENT
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error writing the file
+ * 			3: Error alignment
+ * 			5: Error name (too long, duplicate)
+ * 			7: Error font (LFC_Check_Font_Size)
+ *
+ * Fonts are checked before they are written, a pack that LFC_Pack_Write
+ * accepts is accepted by LFC_Pack_Open.
+ */
+
+uint8_t LFC_Pack_Write(const char * path, const char * const * names, const uint8_t * const * fonts, const uint32_t * sizes, uint16_t count, uint16_t alignment){
+
+	// Validate
+	if(path==NULL || (count && (names==NULL || fonts==NULL || sizes==NULL))){
+		return 1;
+	}
+	if(alignment<4 || (alignment & (alignment - 1))){
+		return 3;
+	}
+
+	for(uint16_t i=0;i<count;i++){
+		if(names[i]==NULL || fonts[i]==NULL){
+			return 1;
+		}
+		size_t name_length = strlen(names[i]);
+		if(name_length==0 || name_length>=LFC_PACK_NAME_SIZE){
+			return 5;
+		}
+		for(uint16_t k=0;k<i;k++){
+			if(strcmp(names[i], names[k])==0){
+				return 5;
+			}
+		}
+		if(LFC_Check_Font_Size(fonts[i], sizes[i])){
+			return 7;
+		}
+	}
+
+	FILE *file = fopen(path, "wb");
+	if(file==NULL){
+		return 2;
+	}
+
+	uint8_t  header[LFC_PACK_HEADER_SIZE];
+	uint8_t  entry[LFC_PACK_ENTRY_SIZE];
+	uint32_t offset = LFC_PACK_HEADER_SIZE + (uint32_t)count * LFC_PACK_ENTRY_SIZE;
+
+	memcpy(header, LFC_PACK_MAGIC, 4);
+	_LFC_Put16(&header[4], LFC_PACK_VERSION);
+	_LFC_Put16(&header[6], count);
+	_LFC_Put16(&header[8], alignment);
+	_LFC_Put16(&header[10], LFC_PACK_ENTRY_SIZE);
+
+	// Directory CRC covers the header fields and the entries
+	uint32_t crc = _LFC_Crc32(0, header, 12);
+
+	uint8_t error = fseek(file, LFC_PACK_HEADER_SIZE, SEEK_SET)!=0;
+
+	for(uint16_t i=0;i<count && !error;i++){
+		offset = (offset + alignment - 1) & ~(uint32_t)(alignment - 1);
+
+		memset(entry, 0, sizeof(entry));
+		memcpy(entry, names[i], strlen(names[i]));
+		_LFC_Put32(&entry[32], offset);
+		_LFC_Put32(&entry[36], sizes[i]);
+		_LFC_Put32(&entry[40], _LFC_Crc32(0, fonts[i], sizes[i]));
+
+		crc = _LFC_Crc32(crc, entry, sizeof(entry));
+		error = fwrite(entry, 1, sizeof(entry), file)!=sizeof(entry);
+
+		offset += sizes[i];
+	}
+
+	_LFC_Put32(&header[12], crc);
+
+	// Fonts, padded to the alignment with zeros
+	for(uint16_t i=0;i<count && !error;i++){
+		long position = ftell(file);
+		uint32_t start = (uint32_t)(position + alignment - 1) & ~(uint32_t)(alignment - 1);
+
+		for(long p=position;p<(long)start && !error;p++){
+			error = fputc(0, file)==EOF;
+		}
+
+		error = error || fwrite(fonts[i], 1, sizes[i], file)!=sizes[i];
+	}
+
+	error = error || fseek(file, 0, SEEK_SET)!=0 || fwrite(header, 1, sizeof(header), file)!=sizeof(header);
+
+	if(fclose(file) || error){
+		remove(path);
+		return 2;
+	}
+
+	return 0;
+}
+
+
+#endif
@@ -0,0 +1,186 @@
+/*
+ *
+ *  File:     lfc_font_pack.h
+ *  Info:     Font pack files for the LFC font library (host builds)
+ *
+ */
+
+
+
+
+/*
+ ******************************************************************************
+
+ The MIT License (MIT)
+ Copyright (c) 2026 M.Cetin Atila
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+
+ ******************************************************************************
+ */
+
+
+
+
+#ifndef LFC_FONT_PACK_H
+#define LFC_FONT_PACK_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include "lfc_font.h"
+
+
+/*
+ * Font pack file (all values little endian)
+ *
+ *  Header (16 bytes)
+ *   0: "LFCP" magic
+ *   4: uint16 version (1)
+ *   6: uint16 font count
+ *   8: uint16 font alignment (power of two, at least 4)
+ *  10: uint16 directory entry size (48)
+ *  12: uint32 CRC-32 of the header bytes 0-11 and the directory
+ *
+ *  Directory (one entry per font, after the header)
+ *   0: char[32] font name (NUL terminated, NUL padded)
+ *  32: uint32 font offset from the pack start (multiple of the font alignment)
+ *  36: uint32 font size in bytes
+ *  40: uint32 CRC-32 of the font bytes
+ *  44: uint32 reserved (0)
+ *
+ *  Fonts: C8 or C9 font bytes (or a wide variant), as in the font arrays
+ */
+
+#define LFC_PACK_MAGIC        "LFCP"
+#define LFC_PACK_VERSION      1
+#define LFC_PACK_HEADER_SIZE  16
+#define LFC_PACK_ENTRY_SIZE   48
+#define LFC_PACK_NAME_SIZE    32  // Font name bytes, names have up to 31 characters
+#define LFC_PACK_ALIGNMENT    64  // Default font alignment (cache line)
+
+
+// Memory-mapped font pack, the font handles point into the mapping
+typedef struct{
+	const uint8_t * map;        // Read-only mapping of the pack file
+	size_t          size;       // Pack size in bytes
+	const uint8_t * directory;  // Directory (after the header)
+	uint16_t        font_count; // Number of fonts
+}LFC_FONT_PACK;
+
+
+/*
+ * @brief Map a font pack read-only and validate it
+ *
+ * @param pack: Font pack structure
+ * @param path: Font pack file path
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error opening or mapping the file
+ * 			3: Error header (magic, version, alignment, entry size)
+ * 			4: Error directory checksum
+ * 			5: Error font entry (name, bounds, alignment, duplicate name)
+ * 			6: Error font checksum
+ * 			7: Error font (LFC_Check_Font_Size)
+ *
+ * Every font is validated here once, font handles can be loaded later
+ * without copies. A pack that fails is unmapped.
+ */
+
+uint8_t LFC_Pack_Open(LFC_FONT_PACK * pack, const char * path);
+
+
+/*
+ * @brief Unmap a font pack
+ *
+ * @param pack: Font pack structure
+ *
+ * Font handles loaded from the pack must not be used after this call.
+ */
+
+void LFC_Pack_Close(LFC_FONT_PACK * pack);
+
+
+/*
+ * @brief Returns the name of a font in the pack
+ *
+ * @param pack: Open font pack
+ * @param index: Font index (0 to font_count - 1)
+ *
+ * @return: Font name, NULL if index is out of the pack
+ */
+
+const char * LFC_Pack_Font_Name(const LFC_FONT_PACK * pack, uint16_t index);
+
+
+/*
+ * @brief Build the font handle of a named font in the pack
+ *
+ * @param pack: Open font pack
+ * @param name: Font name
+ * @param font_handle: Output font handle (points into the mapping)
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error font not found
+ * 			3: Error LFC_Load_Font
+ *
+ */
+
+uint8_t LFC_Pack_Load_Font(const LFC_FONT_PACK * pack, const char * name, LFC_FONT * font_handle);
+
+
+/*
+ * @brief Write a font pack file
+ *
+ * @param path: Font pack file path
+ * @param names: Font names (up to 31 characters)
+ * @param fonts: Font arrays
+ * @param sizes: Font sizes in bytes
+ * @param count: Number of fonts
+ * @param alignment: Font alignment (power of two, at least 4), e.g. LFC_PACK_ALIGNMENT
+ *
+ * @return: 0: Success
+ * 			1: Error NULL pointer
+ * 			2: Error writing the file
+ * 			3: Error alignment
+ * 			5: Error name (too long, duplicate)
+ * 			7: Error font (LFC_Check_Font_Size)
+ *
+ * Write the new pack to a temporary file and rename it over the old pack.
+ * Processes that have the old pack open keep their mapping, a pack must
+ * never be rewritten in place.
+ */
+
+uint8_t LFC_Pack_Write(const char * path, const char * const * names, const uint8_t * const * fonts, const uint32_t * sizes, uint16_t count, uint16_t alignment);
+
+
+#ifdef __cplusplus
+	}//extern "C"
+#endif
+
+
+
+#endif /* LFC_FONT_PACK_H */
@@ -96,11 +96,12 @@ uint8_t Device_Display_1306(DISPLAY_CONTEXT * device_display){
 		return 1;
 	}
 
-	// Set display properties (for ssd1306)
-	device_display->width		    = 128;    // Display width
-	device_display->height		    = 64;     // Display height
-	device_display->rotation	    = 0;	             // Screen rotation (0-3), 0: 0, 1:90, 2:180, 3:270 degree
-	device_display->set_pixel_func  = SSD1306_Set_Pixel; // Pixel write function, it defined in display library
+	// Set display properties (for ssd1306): width, height, rotation (0-3) and
+	// the pixel write function of the display library. All optional fields are cleared.
+	LFC_Display_Init(device_display, 128, 64, 0, SSD1306_Set_Pixel);
+
+	device_display->set_span_func   = SSD1306_Set_Span;  // Horizontal run write function (optional, NULL if not supported)
+	device_display->frame_buffer    = display_buffer;    // Page-major frame buffer for direct rendering (optional, NULL to use callbacks)
 
 	return 0;
 }
@@ -143,6 +144,14 @@ int main(void) {
 
 	//Text_With_Boundary_Box(&main_display);
 
+	//Text_Box_Example(&main_display);
+
+	//Text_Field_Example(&main_display);
+
+	//Render_Benchmark(&main_display);
+
+	//Decoder_Benchmark(&main_display);
+
 
 	Font_Awesome_Example(&main_display);
 
@@ -80,19 +80,50 @@ uint8_t SSD1306_Send_Command(uint8_t cmd) {
  *       This function sends the entire display buffer to the OLED
  */
 uint8_t SSD1306_Flush() {
+	return SSD1306_Flush_Rect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+}
+
+/*
+ * @brief Flush a rectangle of the display buffer to SSD1306 RAM
+ * @param x: Start X coordinate (0-127)
+ * @param y: Start Y coordinate (0-63), rounded down to the page
+ * @param width: Rectangle width in pixels
+ * @param height: Rectangle height in pixels, rounded up to the page
+ * @return 0 if successful (or empty rectangle), error code if failed
+ * @note Error codes same as SSD1306_Send_Command
+ *       Only the covered columns of the covered pages are sent, the
+ *       column/page address window is set to the rectangle
+ */
+uint8_t SSD1306_Flush_Rect(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
 
 	uint32_t timeout;
 	uint32_t timeout_reload=20000;
 
-	// Set column address range (0-127)
-	SSD1306_Send_Command(0x21); // Column address command
-	SSD1306_Send_Command(0x00); // Start column
-	SSD1306_Send_Command(127);  // End column
+	// Clip rectangle to the screen
+	if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT || width == 0 || height == 0) {
+		return 0; // Nothing to send
+	}
+	if (width > SCREEN_WIDTH - x) {
+		width = SCREEN_WIDTH - x;
+	}
+	if (height > SCREEN_HEIGHT - y) {
+		height = SCREEN_HEIGHT - y;
+	}
+
+	uint8_t start_column = x;
+	uint8_t end_column   = x + width - 1;
+	uint8_t start_page   = y / 8;
+	uint8_t end_page     = (y + height - 1) / 8;
+
+	// Set column address range
+	SSD1306_Send_Command(0x21);         // Column address command
+	SSD1306_Send_Command(start_column); // Start column
+	SSD1306_Send_Command(end_column);   // End column
 
-	// Set page address range (0-7 for 64px height)
-	SSD1306_Send_Command(0x22); // Page address command
-	SSD1306_Send_Command(0x00); // Start page
-	SSD1306_Send_Command(7);    // End page
+	// Set page address range
+	SSD1306_Send_Command(0x22);         // Page address command
+	SSD1306_Send_Command(start_page);   // Start page
+	SSD1306_Send_Command(end_page);     // End page
 
 		// Generate I2C START condition
 		I2C_GenerateSTART(I2C_CON, ENABLE);
@@ -121,14 +152,16 @@ uint8_t SSD1306_Flush() {
 			}
 		}
 
-		// Send entire display buffer (1024 bytes for 128x64 display)
-		uint32_t len=(128*64)/8; // Calculate buffer size in bytes
-		for(uint32_t i=0;i<len;i++){
-			I2C_SendData(I2C_CON, display_buffer[i]);
-			timeout=timeout_reload;
-			while (!I2C_CheckEvent(I2C_CON, I2C_EVENT_MASTER_BYTE_TRANSMITTED)){
-				if(!timeout--){
-					return 4; // Timeout error
+		// Send window bytes page by page (horizontal addressing wraps to the next page)
+		for(uint8_t page=start_page;page<=end_page;page++){
+			uint8_t *p=&display_buffer[page*SCREEN_WIDTH+start_column];
+			for(uint16_t i=start_column;i<=end_column;i++){
+				I2C_SendData(I2C_CON, *p++);
+				timeout=timeout_reload;
+				while (!I2C_CheckEvent(I2C_CON, I2C_EVENT_MASTER_BYTE_TRANSMITTED)){
+					if(!timeout--){
+						return 4; // Timeout error
+					}
 				}
 			}
 		}
@@ -235,3 +268,36 @@ void SSD1306_Set_Pixel(uint16_t x, uint16_t y, uint8_t state) {
 	}
 }
 
+/*
+ * @brief Set horizontal run of pixels in display buffer
+ * @param x: Start X coordinate (0-127)
+ * @param y: Y coordinate (0-63)
+ * @param len: Run length in pixels, clipped to the right edge
+ * @param state: 1 = pixel ON, 0 = pixel OFF
+ */
+void SSD1306_Set_Span(uint16_t x, uint16_t y, uint16_t len, uint8_t state) {
+	uint8_t *p;
+	uint8_t mask;
+	// Validate coordinates
+	if (x > 127 || y > 63) {
+		return; // Invalid coordinates, do nothing
+	}
+	// Clip run to the right edge
+	if (len > SCREEN_WIDTH - x) {
+		len = SCREEN_WIDTH - x;
+	}
+	// All pixels of the run are on the same page, only the column changes
+	p    = &display_buffer[((y / 8) * SCREEN_WIDTH) + x];
+	mask = 1 << (y & 7);
+
+	if (state) {
+		while (len--) {
+			*p++ |= mask;
+		}
+	} else {
+		mask = ~mask;
+		while (len--) {
+			*p++ &= mask;
+		}
+	}
+}
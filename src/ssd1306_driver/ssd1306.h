@@ -72,6 +72,19 @@ void SSD1306_Clear(void);
 uint8_t SSD1306_Flush(void);
 
 
+/*
+ * @brief Flush a rectangle of the display buffer to SSD1306 RAM
+ * @param x: Start X coordinate (0-127)
+ * @param y: Start Y coordinate (0-63), rounded down to the page
+ * @param width: Rectangle width in pixels
+ * @param height: Rectangle height in pixels, rounded up to the page
+ * @return 0 if successful (or empty rectangle), error code if failed
+ * @note Only the covered columns of the covered pages are sent
+ *       (same error codes as SSD1306_Flush)
+ */
+uint8_t SSD1306_Flush_Rect(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+
 /*
  * @brief Control display power state
  * @param power_mode: 1 = display ON, 0 = display OFF
@@ -88,6 +101,16 @@ void SSD1306_Power(uint8_t power_mode);
 void SSD1306_Set_Pixel(uint16_t x, uint16_t y, uint8_t state);
 
 
+/*
+ * @brief Set horizontal run of pixels in display buffer
+ * @param x: Start X coordinate (0-127)
+ * @param y: Y coordinate (0-63)
+ * @param len: Run length in pixels, clipped to the right edge
+ * @param state: 1 = pixel ON, 0 = pixel OFF
+ */
+void SSD1306_Set_Span(uint16_t x, uint16_t y, uint16_t len, uint8_t state);
+
+
 
 #ifdef __cplusplus
 	}//extern "C"